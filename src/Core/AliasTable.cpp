@@ -0,0 +1,91 @@
+//
+// AliasTable.cpp
+//
+
+#include <algorithm>
+#include "AliasTable.h"
+#include "Core/Random.h"
+
+AliasTable::AliasTable(const DoubleVector &weights) {
+  build(weights);
+}
+
+void AliasTable::build(const DoubleVector &weights) {
+  build(weights.data(), weights.size());
+}
+
+void AliasTable::build(const double *weights, const std::size_t &size) {
+  weights_.assign(weights, weights + size);
+  probability_.assign(size, 0.0);
+  alias_.resize(size);
+
+  total_weight_ = 0;
+  for (auto i = 0ul; i < size; i++) {
+    total_weight_ += weights[i];
+  }
+  if (size == 0 || total_weight_ <= 0) {
+    return;
+  }
+
+  // Vose: scaled probabilities are split into the ones below and above the average, each small one is topped up
+  // from a large one which becomes its alias
+  std::vector<std::size_t> small, large;
+  small.reserve(size);
+  large.reserve(size);
+  for (auto i = 0ul; i < size; i++) {
+    probability_[i] = weights[i] * static_cast<double>(size) / total_weight_;
+    alias_[i] = i;
+    (probability_[i] < 1.0 ? small : large).push_back(i);
+  }
+
+  while (!small.empty() && !large.empty()) {
+    const auto s = small.back();
+    small.pop_back();
+    const auto l = large.back();
+
+    alias_[s] = l;
+    probability_[l] = (probability_[l] + probability_[s]) - 1.0;
+    if (probability_[l] < 1.0) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+
+  // leftovers are 1 up to rounding error
+  for (auto i : large) {
+    probability_[i] = 1.0;
+  }
+  for (auto i : small) {
+    probability_[i] = 1.0;
+  }
+}
+
+bool AliasTable::build_if_changed(const double *weights, const std::size_t &size) {
+  if (size == weights_.size() && std::equal(weights, weights + size, weights_.begin())) {
+    return false;
+  }
+  build(weights, size);
+  return true;
+}
+
+std::size_t AliasTable::sample(Random *random) const {
+  return sample(random->random_uniform());
+}
+
+std::size_t AliasTable::sample(const double &u) const {
+  const auto scaled = u * static_cast<double>(probability_.size());
+  const auto column = std::min(static_cast<std::size_t>(scaled), probability_.size() - 1);
+  return (scaled - static_cast<double>(column) < probability_[column]) ? column : alias_[column];
+}
+
+std::size_t AliasTable::size() const {
+  return probability_.size();
+}
+
+bool AliasTable::empty() const {
+  return probability_.empty() || total_weight_ <= 0;
+}
+
+double AliasTable::total_weight() const {
+  return total_weight_;
+}
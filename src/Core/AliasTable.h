@@ -0,0 +1,55 @@
+//
+// AliasTable.h
+//
+
+#ifndef ALIASTABLE_H
+#define ALIASTABLE_H
+
+#include <cstddef>
+#include "Core/TypeDef.h"
+
+class Random;
+
+/**
+ * AliasTable draws a category with probability proportional to its weight in O(1), after an O(K) Walker/Vose
+ * construction. The table keeps a copy of its weights so that build_if_changed() only rebuilds it when they differ.
+ */
+class AliasTable {
+ public:
+  AliasTable() = default;
+
+  explicit AliasTable(const DoubleVector &weights);
+
+  virtual ~AliasTable() = default;
+
+  void build(const double *weights, const std::size_t &size);
+
+  void build(const DoubleVector &weights);
+
+  /// returns true when the table had to be rebuilt
+  bool build_if_changed(const double *weights, const std::size_t &size);
+
+  /// index of a category, uses one uniform draw
+  std::size_t sample(Random *random) const;
+
+  /// same as sample(random) for a uniform value u in [0,1)
+  std::size_t sample(const double &u) const;
+
+  std::size_t size() const;
+
+  bool empty() const;
+
+  /// sum of the weights the table was built with
+  double total_weight() const;
+
+ private:
+  DoubleVector weights_;
+
+  DoubleVector probability_;
+
+  std::vector<std::size_t> alias_;
+
+  double total_weight_{0};
+};
+
+#endif // ALIASTABLE_H
@@ -26,7 +26,13 @@ Config::Config(Model* model) :
 
 Config::~Config() = default;
 
-void Config::read_from_file(const std::string &config_file_name) {
+void Config::read_from_file(const std::string &config_file_name, const std::string &cache_file_name,
+                            const std::string &overrides) {
+  cache_.clear();
+  if (!cache_file_name.empty() && overrides.empty()) {
+    cache_.load(cache_file_name, config_file_name);
+  }
+
   YAML::Node config;
   try {
     config = YAML::LoadFile(config_file_name);
@@ -38,10 +44,29 @@ void Config::read_from_file(const std::string &config_file_name) {
     LOG(FATAL) << "error: " << ex.msg << " at line " << ex.mark.line + 1 << ":" << ex.mark.column + 1;
   }
 
+  if (!overrides.empty()) {
+    try {
+      for (const auto &item : YAML::Load(overrides)) {
+        config[item.first.as<std::string>()] = item.second;
+      }
+    }
+    catch (YAML::Exception &ex) {
+      LOG(FATAL) << "error in the config overrides " << overrides << ": " << ex.msg;
+    }
+  }
+
   for (auto &config_item : config_items) {
     LOG(INFO) << "Reading config item: " << config_item->name();
     config_item->set_value(config);
   }
+
+  // the tables have been copied into the config items
+  cache_.clear();
+}
+
+void Config::write_cache(const std::string &config_file_name, const std::string &cache_file_name) {
+  ConfigCache::write(this, config_file_name, cache_file_name);
+  LOG(INFO) << fmt::format("Config cache written to {}", cache_file_name);
 }
 
 
@@ -12,6 +12,7 @@
 #include "Core/TypeDef.h"
 #include "CustomConfigItem.h"
 #include "ConfigItem.h"
+#include "ConfigCache.h"
 #include "Spatial/Location.h"
 #include "Core/MultinomialDistributionGenerator.h"
 #include <string>
@@ -28,6 +29,8 @@ class Config {
  public:
  POINTER_PROPERTY(Model, model)
 
+ READ_ONLY_PROPERTY_REF(ConfigCache, cache)
+
   std::vector<IConfigItem *> config_items{};
 
   CONFIG_ITEM(starting_date, date::year_month_day, date::year_month_day{date::year{1999}/1/1})
@@ -66,6 +69,26 @@ class Config {
   CONFIG_ITEM(using_free_recombination, bool, true)
   CONFIG_ITEM(tf_window_size, int, 60)
 
+  CONFIG_ITEM(bitten_top_20_relative_error, double, 0.01)
+
+  CONFIG_ITEM(using_sparse_movement, bool, false)
+  CONFIG_ITEM(sparse_movement_min_relative_weight, double, 0.0)
+
+  CONFIG_ITEM(using_lazy_drug_concentration, bool, false)
+
+  CONFIG_ITEM(using_hybrid_compartmental_mode, bool, false)
+
+  CONFIG_ITEM(using_tau_leaping, bool, false)
+
+  CONFIG_ITEM(tau_leaping_step, int, 7)
+
+  CONFIG_ITEM(using_adaptive_time_step, bool, false)
+
+  CONFIG_ITEM(adaptive_time_step_max_days, int, 30)
+
+  CONFIG_ITEM(function_table_max_error, double, 0)
+  CONFIG_ITEM(function_table_max_points, int, 1 << 17)
+
   CONFIG_ITEM(using_age_dependent_bitting_level, bool, false)
   CONFIG_ITEM(using_variable_probability_infectious_bites_cause_infection, bool, false)
 
@@ -107,7 +130,7 @@ class Config {
 
   CUSTOM_CONFIG_ITEM(number_of_locations, 1)
 
-  CUSTOM_CONFIG_ITEM(spatial_distance_matrix, DoubleVector2())
+  CUSTOM_CONFIG_ITEM(spatial_distance_matrix, 0.0)
 
   CUSTOM_CONFIG_ITEM(seasonal_info, SeasonalInfo())
 
@@ -115,13 +138,15 @@ class Config {
 
   CUSTOM_CONFIG_ITEM(immune_system_information, ImmuneSystemInformation())
 
+  CUSTOM_CONFIG_ITEM(function_tables, FunctionTables())
+
   CUSTOM_CONFIG_ITEM(genotype_db, nullptr)
 
   CUSTOM_CONFIG_ITEM(number_of_parasite_types, 0)
 
   CUSTOM_CONFIG_ITEM(drug_db, nullptr)
 
-  CUSTOM_CONFIG_ITEM(EC50_power_n_table, DoubleVector2())
+  CUSTOM_CONFIG_ITEM(EC50_power_n_table, DoubleMatrix())
 
   CUSTOM_CONFIG_ITEM(circulation_info, RelativeMovingInformation())
 
@@ -152,7 +177,15 @@ class Config {
 
   virtual ~Config();
 
-  void read_from_file(const std::string &config_file_name = "config.yml");
+  /**
+   * Reads the YAML input, the derived tables are taken from cache_file_name when it is a valid cache of this input.
+   * overrides is a YAML map (ex: "{using_hybrid_compartmental_mode: true}") whose items replace the items of the same
+   * name in the config file. The cache is not used when there are overrides.
+   */
+  void read_from_file(const std::string &config_file_name = "config.yml", const std::string &cache_file_name = "",
+                      const std::string &overrides = "");
+
+  void write_cache(const std::string &config_file_name, const std::string &cache_file_name);
 
 };
 
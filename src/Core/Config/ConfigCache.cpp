@@ -0,0 +1,244 @@
+//
+// ConfigCache.cpp
+//
+
+#include <cstring>
+#include <fstream>
+#include "ConfigCache.h"
+#include "Config.h"
+#include "easylogging++.h"
+
+namespace {
+const char MAGIC[8] = {'M', 'A', 'S', 'I', 'M', 'C', 'F', 'G'};
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t number_of_sections;
+  uint64_t config_hash;
+};
+
+struct SectionData {
+  ConfigCache::Section section;
+  ConfigCache::ElementType type;
+  uint64_t rows;
+  uint64_t cols;
+  std::vector<char> bytes;
+};
+
+template <typename T>
+SectionData make_section(const ConfigCache::Section &section, const ConfigCache::ElementType &type,
+                         const std::vector<T> &vector) {
+  SectionData result{section, type, 1, vector.size(), std::vector<char>(vector.size() * sizeof(T))};
+  if (!vector.empty()) {
+    std::memcpy(result.bytes.data(), vector.data(), result.bytes.size());
+  }
+  return result;
+}
+
+SectionData make_section(const ConfigCache::Section &section, const DoubleVector2 &matrix) {
+  DoubleVector values;
+  for (const auto &row : matrix) {
+    values.insert(values.end(), row.begin(), row.end());
+  }
+  auto result = make_section(section, ConfigCache::DOUBLE, values);
+  result.rows = matrix.size();
+  result.cols = matrix.empty() ? 0 : matrix[0].size();
+  return result;
+}
+
+SectionData make_section(const ConfigCache::Section &section, const DoubleVector &vector) {
+  return make_section(section, ConfigCache::DOUBLE, vector);
+}
+
+uint64_t aligned_size(const uint64_t &size) {
+  return (size + 7) / 8 * 8;
+}
+}
+
+ConfigCache::ConfigCache() : entries_(NUMBER_OF_SECTIONS, Entry{0, 0, 0, 0, 0}) {}
+
+uint64_t ConfigCache::hash_file(const std::string &file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  uint64_t hash = 14695981039346656037ull;
+  char c;
+  while (file.get(c)) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+void ConfigCache::write(Config *config, const std::string &config_file_name, const std::string &cache_file_name) {
+  std::vector<SectionData> sections;
+
+  // rows as they are kept in memory, so a matrix with a cutoff is written sparse
+  const auto &distance_matrix = config->spatial_distance_matrix();
+  DoubleVector row_offsets{0};
+  std::vector<int> locations;
+  std::vector<float> distances;
+  for (auto from_location = 0; from_location < distance_matrix.number_of_locations(); from_location++) {
+    const auto &row = distance_matrix.row(from_location);
+    locations.insert(locations.end(), row.locations.begin(), row.locations.end());
+    distances.insert(distances.end(), row.distances.begin(), row.distances.end());
+    row_offsets.push_back(static_cast<double>(distances.size()));
+  }
+  sections.push_back(make_section(SPATIAL_DISTANCE_ROW_OFFSETS, row_offsets));
+  sections.push_back(make_section(SPATIAL_DISTANCE_LOCATIONS, INT32, locations));
+  sections.push_back(make_section(SPATIAL_DISTANCE_VALUES, FLOAT, distances));
+
+  sections.push_back(make_section(EC50_POWER_N_TABLE, config->EC50_power_n_table().to_nested()));
+
+  const auto &mating_matrix = config->genotype_db()->mating_matrix();
+  DoubleVector2 packed_mating_matrix;
+  for (auto m = 1ul; m < mating_matrix.size(); m++) {
+    for (auto f = 0ul; f < m; f++) {
+      packed_mating_matrix.push_back(mating_matrix[m][f]);
+    }
+  }
+  sections.push_back(make_section(MATING_MATRIX, packed_mating_matrix));
+
+  sections.push_back(make_section(BITING_LEVEL_DENSITY, config->relative_bitting_info().v_biting_level_density));
+  sections.push_back(make_section(BITING_LEVEL_VALUE, config->relative_bitting_info().v_biting_level_value));
+  sections.push_back(make_section(MOVING_LEVEL_DENSITY, config->circulation_info().v_moving_level_density));
+  sections.push_back(make_section(MOVING_LEVEL_VALUE, config->circulation_info().v_moving_level_value));
+
+  Header header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.number_of_sections = static_cast<uint32_t>(sections.size());
+  header.config_hash = hash_file(config_file_name);
+
+  std::vector<Entry> entries;
+  uint64_t offset = sizeof(Header) + sections.size() * sizeof(Entry);
+  for (const auto &section : sections) {
+    entries.push_back(Entry{static_cast<uint32_t>(section.section), static_cast<uint32_t>(section.type), offset,
+                            section.rows, section.cols});
+    offset += aligned_size(section.bytes.size());
+  }
+
+  std::ofstream file(cache_file_name, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    LOG(FATAL) << "Cannot write config cache to " << cache_file_name;
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry));
+  const char padding[8] = {};
+  for (const auto &section : sections) {
+    file.write(section.bytes.data(), section.bytes.size());
+    file.write(padding, aligned_size(section.bytes.size()) - section.bytes.size());
+  }
+}
+
+bool ConfigCache::load(const std::string &cache_file_name, const std::string &config_file_name) {
+  clear();
+
+  std::ifstream file(cache_file_name, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    LOG(WARNING) << "Config cache " << cache_file_name << " not found, derived tables will be recomputed";
+    return false;
+  }
+  std::vector<char> buffer(static_cast<std::size_t>(file.tellg()));
+  file.seekg(0);
+  file.read(buffer.data(), buffer.size());
+
+  Header header{};
+  if (buffer.size() < sizeof(Header)) {
+    LOG(WARNING) << "Config cache " << cache_file_name << " is truncated, derived tables will be recomputed";
+    return false;
+  }
+  std::memcpy(&header, buffer.data(), sizeof(Header));
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+    LOG(WARNING) << "Config cache " << cache_file_name << " has an unsupported format, derived tables will be recomputed";
+    return false;
+  }
+  if (header.config_hash != hash_file(config_file_name)) {
+    LOG(WARNING) << "Config cache " << cache_file_name << " was built from another version of " << config_file_name
+                 << ", derived tables will be recomputed";
+    return false;
+  }
+
+  const auto entries_end = sizeof(Header) + header.number_of_sections * sizeof(Entry);
+  if (buffer.size() < entries_end) {
+    LOG(WARNING) << "Config cache " << cache_file_name << " is truncated, derived tables will be recomputed";
+    return false;
+  }
+  for (auto i = 0u; i < header.number_of_sections; i++) {
+    Entry entry{};
+    std::memcpy(&entry, buffer.data() + sizeof(Header) + i * sizeof(Entry), sizeof(Entry));
+    if (entry.id >= NUMBER_OF_SECTIONS || entry.type >= NUMBER_OF_ELEMENT_TYPES
+        || entry.offset + entry.rows * entry.cols * element_size(entry.type) > buffer.size()) {
+      LOG(WARNING) << "Config cache " << cache_file_name << " is corrupted, derived tables will be recomputed";
+      clear();
+      return false;
+    }
+    entries_[entry.id] = entry;
+  }
+
+  buffer_ = std::move(buffer);
+  LOG(INFO) << "Loaded config cache " << cache_file_name;
+  return true;
+}
+
+void ConfigCache::clear() {
+  buffer_.clear();
+  entries_.assign(NUMBER_OF_SECTIONS, Entry{0, 0, 0, 0, 0});
+}
+
+bool ConfigCache::has(const Section &section) const {
+  return entries_[section].offset != 0;
+}
+
+std::size_t ConfigCache::element_size(const uint32_t &type) {
+  switch (type) {
+    case FLOAT:
+      return sizeof(float);
+    case INT32:
+      return sizeof(int32_t);
+    default:
+      return sizeof(double);
+  }
+}
+
+const double* ConfigCache::data(const Section &section) const {
+  return reinterpret_cast<const double*>(buffer_.data() + entries_[section].offset);
+}
+
+template <typename T>
+std::vector<T> ConfigCache::values(const Section &section, const ElementType &type) const {
+  if (entries_[section].type != type) {
+    LOG(FATAL) << "Config cache section " << section << " does not hold elements of type " << type;
+  }
+  const auto size = entries_[section].rows * entries_[section].cols;
+  std::vector<T> result(size);
+  if (size > 0) {
+    std::memcpy(result.data(), buffer_.data() + entries_[section].offset, size * sizeof(T));
+  }
+  return result;
+}
+
+DoubleVector ConfigCache::vector(const Section &section) const {
+  return values<double>(section, DOUBLE);
+}
+
+std::vector<float> ConfigCache::float_vector(const Section &section) const {
+  return values<float>(section, FLOAT);
+}
+
+std::vector<int> ConfigCache::int_vector(const Section &section) const {
+  return values<int>(section, INT32);
+}
+
+DoubleVector2 ConfigCache::matrix(const Section &section) const {
+  const auto &entry = entries_[section];
+  if (entry.type != DOUBLE) {
+    LOG(FATAL) << "Config cache section " << section << " does not hold elements of type " << DOUBLE;
+  }
+  DoubleVector2 result(entry.rows, DoubleVector(entry.cols));
+  for (auto row = 0ul; row < entry.rows; row++) {
+    if (entry.cols > 0) {
+      std::memcpy(result[row].data(), data(section) + row * entry.cols, entry.cols * sizeof(double));
+    }
+  }
+  return result;
+}
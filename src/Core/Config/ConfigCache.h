@@ -0,0 +1,114 @@
+//
+// ConfigCache.h
+//
+
+#ifndef CONFIGCACHE_H
+#define CONFIGCACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Core/PropertyMacro.h"
+#include "Core/TypeDef.h"
+
+class Config;
+
+/**
+ * ConfigCache stores the tables that Config derives from the YAML input (distance matrix, EC50^n table, mating
+ * matrix, biting and moving level distributions) in a versioned binary file, so that later runs with the same
+ * input can skip recomputing them.
+ *
+ * Layout (little endian, every section 8-byte aligned so the tables are read in place from the loaded file):
+ *   header  : magic "MASIMCFG", uint32 version, uint32 number of sections, uint64 hash of the YAML input
+ *   entries : per section uint32 id, uint32 element type, uint64 offset, uint64 rows, uint64 cols
+ *   data    : rows x cols elements per section, row major
+ *
+ * The distance matrix is stored as its rows are kept in memory: only the destinations within cutoff_in_km when the
+ * input sets one, so the file grows with the number of kept pairs rather than with the square of the number of
+ * locations.
+ *
+ * A cache is only used when its version and the hash of the YAML file match, otherwise every table is recomputed.
+ * The cache does not replace the YAML input: the file is still parsed and every config item still runs its set_value.
+ * Only the items above (spatial_distance_matrix, EC50_power_n_table, genotype_info for the mating matrix,
+ * relative_bitting_info and circulation_info) copy their derived table from the cache instead of computing it.
+ */
+class ConfigCache {
+ DISALLOW_COPY_AND_ASSIGN(ConfigCache)
+
+ DISALLOW_MOVE(ConfigCache)
+
+ public:
+  enum Section {
+    // number of locations + 1 values, the index in SPATIAL_DISTANCE_VALUES where each row starts
+    SPATIAL_DISTANCE_ROW_OFFSETS = 0,
+    // destinations of every row, empty when the matrix has no cutoff
+    SPATIAL_DISTANCE_LOCATIONS,
+    SPATIAL_DISTANCE_VALUES,
+    EC50_POWER_N_TABLE,
+    // one row per (m, f) pair with f < m, in the order m = 1..n-1, f = 0..m-1
+    MATING_MATRIX,
+    BITING_LEVEL_DENSITY,
+    BITING_LEVEL_VALUE,
+    MOVING_LEVEL_DENSITY,
+    MOVING_LEVEL_VALUE,
+    NUMBER_OF_SECTIONS
+  };
+
+  enum ElementType {
+    DOUBLE = 0,
+    FLOAT,
+    INT32,
+    NUMBER_OF_ELEMENT_TYPES
+  };
+
+  static const uint32_t VERSION = 2;
+
+ public:
+  ConfigCache();
+
+  virtual ~ConfigCache() = default;
+
+  /// FNV-1a hash of the file content
+  static uint64_t hash_file(const std::string &file_name);
+
+  /// writes the derived tables of an already read config
+  static void write(Config *config, const std::string &config_file_name, const std::string &cache_file_name);
+
+  /// reads the whole file into memory with a single read, returns false (and keeps the cache empty) if the file is
+  /// missing, of another version or built from another input
+  bool load(const std::string &cache_file_name, const std::string &config_file_name);
+
+  void clear();
+
+  bool has(const Section &section) const;
+
+  DoubleVector vector(const Section &section) const;
+
+  DoubleVector2 matrix(const Section &section) const;
+
+  std::vector<float> float_vector(const Section &section) const;
+
+  std::vector<int> int_vector(const Section &section) const;
+
+  static std::size_t element_size(const uint32_t &type);
+
+ private:
+  struct Entry {
+    uint32_t id;
+    uint32_t type;
+    uint64_t offset;
+    uint64_t rows;
+    uint64_t cols;
+  };
+
+  const double *data(const Section &section) const;
+
+  template <typename T>
+  std::vector<T> values(const Section &section, const ElementType &type) const;
+
+  std::vector<char> buffer_;
+
+  std::vector<Entry> entries_;
+};
+
+#endif // CONFIGCACHE_H
@@ -6,15 +6,20 @@
 #include "Spatial/SpatialModelBuilder.h"
 #include "Helpers/ObjectHelpers.h"
 #include "Helpers/NumberHelpers.h"
+#include "Helpers/StringHelpers.h"
+#include "Constants.h"
 #include "Therapies/Therapy.h"
 #include "Therapies/TherapyBuilder.h"
+#include "Therapies/SCTherapy.h"
 #include "Strategies/IStrategy.h"
 #include "Strategies/StrategyBuilder.h"
 #include "Events/Population/PopulationEventBuilder.h"
+#include "Population/ImmuneSystem.h"
 #include <gsl/gsl_cdf.h>
 #include <cmath>
 #include <date/date.h>
 #include <algorithm>
+#include <fstream>
 
 void total_time::set_value(const YAML::Node &node) {
   value_ = (date::sys_days{config_->ending_date()} - date::sys_days(config_->starting_date())).count();
@@ -29,19 +34,33 @@ void number_of_locations::set_value(const YAML::Node &node) {
 }
 
 void spatial_distance_matrix::set_value(const YAML::Node &node) {
-  value_.resize(static_cast<unsigned long>(config_->number_of_locations()));
-  for (auto from_location = 0ul; from_location < config_->number_of_locations(); from_location++) {
-    value_[from_location].resize(static_cast<unsigned long long int>(config_->number_of_locations()));
-    for (auto to_location = 0ul; to_location < config_->number_of_locations(); to_location++) {
-      value_[from_location][to_location] = Spatial::Coordinate::calculate_distance_in_km(
-        *config_->location_db()[from_location].coordinate,
-        *config_->location_db()[to_location].coordinate);
-      //
-      //            std::cout << "distance[" << from_location << "," << to_location << "]: "
-      //                      << spatial_distance_matrix_[from_location][to_location] << std::endl;
+  // optional node, e.g. spatial_distance_matrix: { cutoff_in_km: 200 } to only keep destinations within 200km
+  auto cutoff_in_km = default_cutoff_in_km_;
+  if (node[name_] && node[name_]["cutoff_in_km"]) {
+    cutoff_in_km = node[name_]["cutoff_in_km"].as<double>();
+  }
+  value_.initialize(config_->location_db(), cutoff_in_km);
+
+  const auto &cache = config_->cache();
+  if (cache.has(ConfigCache::SPATIAL_DISTANCE_ROW_OFFSETS) && cache.has(ConfigCache::SPATIAL_DISTANCE_LOCATIONS)
+      && cache.has(ConfigCache::SPATIAL_DISTANCE_VALUES)) {
+    const auto row_offsets = cache.vector(ConfigCache::SPATIAL_DISTANCE_ROW_OFFSETS);
+    const auto locations = cache.int_vector(ConfigCache::SPATIAL_DISTANCE_LOCATIONS);
+    const auto distances = cache.float_vector(ConfigCache::SPATIAL_DISTANCE_VALUES);
+    if (row_offsets.size() == static_cast<std::size_t>(value_.number_of_locations()) + 1) {
+      for (auto from_location = 0; from_location < value_.number_of_locations(); from_location++) {
+        const auto begin = static_cast<std::size_t>(row_offsets[from_location]);
+        const auto end = static_cast<std::size_t>(row_offsets[from_location + 1]);
+        value_.set_row(from_location,
+                       locations.empty() ? std::vector<int>()
+                                         : std::vector<int>(locations.begin() + begin, locations.begin() + end),
+                       std::vector<float>(distances.begin() + begin, distances.begin() + end));
+      }
+    } else {
+      LOG(WARNING) << "Cached distance matrix has another number of locations, rows will be computed on first use";
     }
   }
-
+  // otherwise rows are computed on first use
 }
 
 void seasonal_info::set_value(const YAML::Node &node) {
@@ -51,23 +70,95 @@ void seasonal_info::set_value(const YAML::Node &node) {
   value_.C.clear();
   value_.phi.clear();
   value_.min_value.clear();
+  value_.factors.clear();
   value_.enable = seasonal_info_node["enable"].as<bool>();
 
-  for (auto i = 0ul; i < config_->number_of_locations(); i++) {
-    auto input_loc = seasonal_info_node["a"].size() < config_->number_of_locations() ? 0 : i;
-    value_.A.push_back(seasonal_info_node["a"][input_loc].as<double>());
+  // the equation parameters are optional when measured daily factors are given
+  if (seasonal_info_node["a"] || !seasonal_info_node["daily_factors_file"]) {
+    for (auto i = 0ul; i < config_->number_of_locations(); i++) {
+      auto input_loc = seasonal_info_node["a"].size() < config_->number_of_locations() ? 0 : i;
+      value_.A.push_back(seasonal_info_node["a"][input_loc].as<double>());
+
+      const auto period = seasonal_info_node["period"].as<double>();
+      auto B = 2 * M_PI / period;
+
+      value_.B.push_back(B);
+
+      const auto phi = seasonal_info_node["phi"][input_loc].as<float>();
+      value_.phi.push_back(phi);
+      auto C = -phi * B;
+      value_.C.push_back(C);
 
-    const auto period = seasonal_info_node["period"].as<double>();
-    auto B = 2 * M_PI / period;
+      value_.min_value.push_back(seasonal_info_node["min_value"][input_loc].as<float>());
+    }
+  }
 
-    value_.B.push_back(B);
+  if (!value_.enable) return;
 
-    const auto phi = seasonal_info_node["phi"][input_loc].as<float>();
-    value_.phi.push_back(phi);
-    auto C = -phi * B;
-    value_.C.push_back(C);
+  value_.factors.resize(config_->number_of_locations() * SeasonalInfo::DAYS_IN_TABLE);
+  if (seasonal_info_node["daily_factors_file"]) {
+    read_daily_factors(seasonal_info_node["daily_factors_file"].as<std::string>());
+    return;
+  }
 
-    value_.min_value.push_back(seasonal_info_node["min_value"][input_loc].as<float>());
+  for (auto location = 0ul; location < config_->number_of_locations(); location++) {
+    for (auto day_of_year = 1; day_of_year < SeasonalInfo::DAYS_IN_TABLE; day_of_year++) {
+      value_.factors[location * SeasonalInfo::DAYS_IN_TABLE + day_of_year] = compute_factor(location, day_of_year);
+    }
+  }
+}
+
+double seasonal_info::compute_factor(const int &location, const int &day_of_year) const {
+  const auto is_rainy_period = value_.phi[location] < Constants::DAYS_IN_YEAR() / 2.0
+                               ? day_of_year >= value_.phi[location]
+                                 && day_of_year <= value_.phi[location] + Constants::DAYS_IN_YEAR() / 2.0
+                               : day_of_year >= value_.phi[location]
+                                 || day_of_year <= value_.phi[location] - Constants::DAYS_IN_YEAR() / 2.0;
+
+  return (is_rainy_period)
+         ? (value_.A[location] - value_.min_value[location]) *
+           sin(value_.B[location] * day_of_year + value_.C[location]) + value_.min_value[location]
+         : value_.min_value[location];
+}
+
+void seasonal_info::read_daily_factors(const std::string &file_name) {
+  std::ifstream file(file_name);
+  if (!file.is_open()) {
+    LOG(FATAL) << "Seasonal daily factors file " << file_name << " not found";
+  }
+
+  // one line of comma separated factors by day of year per location, a single line applies to every location
+  std::vector<DoubleVector> rows;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    DoubleVector row;
+    for (const auto &token : StringHelpers::split(line, std::string(", \t\r"))) {
+      row.push_back(std::stod(token));
+    }
+    if (row.empty()) continue;
+    if (row.size() != Constants::DAYS_IN_YEAR() && row.size() != Constants::DAYS_IN_YEAR() + 1) {
+      LOG(FATAL) << "Seasonal daily factors file " << file_name << ": line " << rows.size() + 1 << " has "
+                 << row.size() << " values, " << Constants::DAYS_IN_YEAR() << " or " << Constants::DAYS_IN_YEAR() + 1
+                 << " expected";
+    }
+    // day 366 of a leap year uses the value of day 365 when it is not given
+    if (row.size() == Constants::DAYS_IN_YEAR()) {
+      row.push_back(row.back());
+    }
+    rows.push_back(row);
+  }
+
+  if (rows.size() != 1 && rows.size() != config_->number_of_locations()) {
+    LOG(FATAL) << "Seasonal daily factors file " << file_name << " has " << rows.size() << " lines, 1 or "
+               << config_->number_of_locations() << " expected";
+  }
+
+  for (auto location = 0ul; location < config_->number_of_locations(); location++) {
+    const auto &row = rows.size() == 1 ? rows[0] : rows[location];
+    for (auto day_of_year = 1; day_of_year < SeasonalInfo::DAYS_IN_TABLE; day_of_year++) {
+      value_.factors[location * SeasonalInfo::DAYS_IN_TABLE + day_of_year] = row[day_of_year - 1];
+    }
   }
 }
 
@@ -149,6 +240,35 @@ void immune_system_information::set_value(const YAML::Node &node) {
                          value_.duration_for_naive);
 }
 
+void function_tables::set_value(const YAML::Node &node) {
+  const auto max_error = config_->function_table_max_error();
+  const auto max_points = config_->function_table_max_points();
+
+  const auto sigma = config_->relative_infectivity().sigma;
+  const auto ro_star = config_->relative_infectivity().ro_star;
+  value_.relative_infectivity.build([sigma, ro_star](const double &log10_parasite_density) {
+                                      const auto p = gsl_cdf_ugaussian_P(log10_parasite_density * sigma + ro_star);
+                                      return p * p + 0.01;
+                                    },
+                                    config_->parasite_density_level().log_parasite_density_cured - 1,
+                                    config_->parasite_density_level().log_parasite_density_clinical_to + 1,
+                                    max_error, max_points);
+
+  const auto isf = config_->immune_system_information();
+  value_.clinical_progression.build([isf](const double &immune) {
+                                      return ImmuneSystem::get_clinical_progression_probability(isf, immune);
+                                    },
+                                    0, 1, max_error, max_points);
+
+  value_.exp_minus.build([](const double &x) { return exp(-x); }, 0, 50, max_error, max_points);
+
+  LOG(INFO) << "Function tables (points, max error): relative infectivity ("
+            << value_.relative_infectivity.number_of_points() << ", " << value_.relative_infectivity.max_error()
+            << "), clinical progression (" << value_.clinical_progression.number_of_points() << ", "
+            << value_.clinical_progression.max_error() << "), exp(-x) (" << value_.exp_minus.number_of_points()
+            << ", " << value_.exp_minus.max_error() << ")";
+}
+
 genotype_db::~genotype_db() {
   ObjectHelpers::delete_pointer<GenotypeDatabase>(value_);
 }
@@ -157,6 +277,15 @@ void genotype_db::set_value(const YAML::Node &node) {
 
   value_ = new GenotypeDatabase();
 
+  auto number_of_alleles = 0ul;
+  for (auto &locus : config_->genotype_info().loci_vector) {
+    number_of_alleles += locus.alleles.size();
+  }
+  if (number_of_alleles > Genotype::MAX_NUMBER_OF_ALLELES) {
+    LOG(FATAL) << "Genotypes are packed in " << Genotype::MAX_NUMBER_OF_ALLELES << " bits, but the loci have "
+               << number_of_alleles << " alleles";
+  }
+
   value_->weight().clear();
   value_->weight().assign(config_->genotype_info().loci_vector.size(), 1);
 
@@ -177,8 +306,21 @@ void genotype_db::set_value(const YAML::Node &node) {
 //    std::cout << *int_genotype << std::endl;
     value_->add(int_genotype);
   }
-
-  value_->initialize_matting_matrix();
+  value_->initialize_mutation_table(config_->genotype_info());
+
+  if (config_->cache().has(ConfigCache::MATING_MATRIX)) {
+    const auto packed_mating_matrix = config_->cache().matrix(ConfigCache::MATING_MATRIX);
+    value_->mating_matrix() = MatingMatrix(number_of_genotypes,
+                                           std::vector<std::vector<double>>(number_of_genotypes, std::vector<double>()));
+    auto row = 0;
+    for (auto m = 1; m < number_of_genotypes; m++) {
+      for (auto f = 0; f < m; f++) {
+        value_->mating_matrix()[m][f] = packed_mating_matrix[row++];
+      }
+    }
+  } else {
+    value_->initialize_matting_matrix();
+  }
 
 }
 
@@ -230,6 +372,16 @@ void drug_db::set_value(const YAML::Node &node) {
       }
     }
 
+    dt->resistant_allele_bits() = 0;
+    for (std::size_t i = 0; i < dt->affecting_loci().size(); i++) {
+      const auto locus = dt->affecting_loci()[i];
+      for (auto allele : dt->selecting_alleles()[i]) {
+        if (allele < config_->genotype_info().loci_vector[locus].alleles.size()) {
+          dt->resistant_allele_bits() |= Genotype::allele_bit(config_->genotype_info(), locus, allele);
+        }
+      }
+    }
+
     dt->set_ec50_map(dt_node["EC50"].as<std::map<std::string, double>>());
 
     //    auto ec50Node = node["EC50"];
@@ -246,16 +398,22 @@ void drug_db::set_value(const YAML::Node &node) {
     value_->add(dt);
 
   }
+
+  config_->genotype_db()->initialize_resistance(value_);
 }
 
 void EC50_power_n_table::set_value(const YAML::Node &node) {
-  //get EC50 table and compute EC50^n
-  value_.clear();
-  value_.assign(config_->genotype_db()->size(), std::vector<double>());
+  if (config_->cache().has(ConfigCache::EC50_POWER_N_TABLE)) {
+    value_ = DoubleMatrix(config_->cache().matrix(ConfigCache::EC50_POWER_N_TABLE));
+    return;
+  }
+
+  //get EC50 table and compute EC50^n, one contiguous row of drugs per genotype
+  value_ = DoubleMatrix(config_->genotype_db()->size(), config_->drug_db()->size());
 
   for (auto g_id = 0; g_id < config_->genotype_db()->size(); g_id++) {
     for (auto i = 0; i < config_->drug_db()->size(); i++) {
-      value_[g_id].push_back(config_->drug_db()->at(i)->infer_ec50(config_->genotype_db()->at(g_id)));
+      value_[g_id][i] = config_->drug_db()->at(i)->infer_ec50(config_->genotype_db()->at(g_id));
     }
   }
 
@@ -288,37 +446,42 @@ void circulation_info::set_value(const YAML::Node &node) {
   value_.v_moving_level_density.clear();
   value_.v_moving_level_value.clear();
 
-  const auto max = value_.max_relative_moving_value - 1; //maxRelativeBiting -1
-  const auto number_of_level = value_.number_of_moving_levels;
-
-  const auto step = max / static_cast<double>(number_of_level - 1);
-
-  auto j = 0;
-  double old_p = 0;
-  double sum = 0;
-  //TODO: fix it
-  for (double i = 0; i <= max + 0.0001; i += step) {
-    const auto p = gsl_cdf_gamma_P(i + step, a, b);
-    double value = 0;
-    value = (j == 0) ? p : p - old_p;
-    value_.v_moving_level_density.push_back(value);
-    old_p = p;
-    value_.v_moving_level_value.push_back(i + 1);
-    sum += value;
-    j++;
+  if (config_->cache().has(ConfigCache::MOVING_LEVEL_DENSITY) && config_->cache().has(ConfigCache::MOVING_LEVEL_VALUE)) {
+    value_.v_moving_level_density = config_->cache().vector(ConfigCache::MOVING_LEVEL_DENSITY);
+    value_.v_moving_level_value = config_->cache().vector(ConfigCache::MOVING_LEVEL_VALUE);
+  } else {
+    const auto max = value_.max_relative_moving_value - 1; //maxRelativeBiting -1
+    const auto number_of_level = value_.number_of_moving_levels;
+
+    const auto step = max / static_cast<double>(number_of_level - 1);
+
+    auto j = 0;
+    double old_p = 0;
+    double sum = 0;
+    //TODO: fix it
+    for (double i = 0; i <= max + 0.0001; i += step) {
+      const auto p = gsl_cdf_gamma_P(i + step, a, b);
+      double value = 0;
+      value = (j == 0) ? p : p - old_p;
+      value_.v_moving_level_density.push_back(value);
+      old_p = p;
+      value_.v_moving_level_value.push_back(i + 1);
+      sum += value;
+      j++;
 
-  }
+    }
 
-  //normalized
-  double t = 0;
-  for (auto &i : value_.v_moving_level_density) {
-    i = i + (1 - sum) / value_.v_moving_level_density.size();
-    t += i;
+    //normalized
+    double t = 0;
+    for (auto &i : value_.v_moving_level_density) {
+      i = i + (1 - sum) / value_.v_moving_level_density.size();
+      t += i;
+    }
+    assert(fabs(t - 1) < 0.0001);
   }
 
   assert(value_.number_of_moving_levels == value_.v_moving_level_density.size());
   assert(value_.number_of_moving_levels == value_.v_moving_level_value.size());
-  assert(fabs(t - 1) < 0.0001);
 
   value_.circulation_percent = info_node["circulation_percent"].as<double>();
 
@@ -353,38 +516,43 @@ void relative_bitting_info::set_value(const YAML::Node &node) {
   value_.v_biting_level_density.clear();
   value_.v_biting_level_value.clear();
 
-  const auto max = value_.max_relative_biting_value - 1; //maxRelativeBiting -1
-  const auto number_of_level = value_.number_of_biting_levels;
+  if (config_->cache().has(ConfigCache::BITING_LEVEL_DENSITY) && config_->cache().has(ConfigCache::BITING_LEVEL_VALUE)) {
+    value_.v_biting_level_density = config_->cache().vector(ConfigCache::BITING_LEVEL_DENSITY);
+    value_.v_biting_level_value = config_->cache().vector(ConfigCache::BITING_LEVEL_VALUE);
+  } else {
+    const auto max = value_.max_relative_biting_value - 1; //maxRelativeBiting -1
+    const auto number_of_level = value_.number_of_biting_levels;
 
-  const auto step = max / static_cast<double>(number_of_level - 1);
+    const auto step = max / static_cast<double>(number_of_level - 1);
 
-  auto j = 0;
-  auto old_p = 0.0;
-  auto sum = 0.0;
+    auto j = 0;
+    auto old_p = 0.0;
+    auto sum = 0.0;
 
-  for (double i = 0; i <= max + 0.0001; i += step) {
-    const auto p = gsl_cdf_gamma_P(i + step, a, b);
-    double value = 0;
-    value = (j == 0) ? p : p - old_p;
-    value_.v_biting_level_density.push_back(value);
-    old_p = p;
-    value_.v_biting_level_value.push_back(i + 1);
-    sum += value;
-    j++;
+    for (double i = 0; i <= max + 0.0001; i += step) {
+      const auto p = gsl_cdf_gamma_P(i + step, a, b);
+      double value = 0;
+      value = (j == 0) ? p : p - old_p;
+      value_.v_biting_level_density.push_back(value);
+      old_p = p;
+      value_.v_biting_level_value.push_back(i + 1);
+      sum += value;
+      j++;
 
-  }
+    }
 
 
-  //normalized
-  double t = 0;
-  for (auto &i : value_.v_biting_level_density) {
-    i = i + (1 - sum) / value_.v_biting_level_density.size();
-    t += i;
+    //normalized
+    double t = 0;
+    for (auto &i : value_.v_biting_level_density) {
+      i = i + (1 - sum) / value_.v_biting_level_density.size();
+      t += i;
+    }
+    assert(fabs(t - 1) < 0.0001);
   }
 
   assert(value_.number_of_biting_levels == value_.v_biting_level_density.size());
   assert(value_.number_of_biting_levels == value_.v_biting_level_value.size());
-  assert(fabs(t - 1) < 0.0001);
 
 }
 
@@ -405,6 +573,11 @@ void therapy_db::set_value(const YAML::Node &node) {
   //    read_all_therapy
   for (std::size_t i = 0; i < node[name_].size(); i++) {
     auto* t = read_therapy(node[name_], (int) i);
+    if (dynamic_cast<SCTherapy*>(t) != nullptr) {
+      for (auto drug_id : t->drug_ids) {
+        t->resistant_allele_bits |= config_->drug_db()->at(drug_id)->resistant_allele_bits();
+      }
+    }
     value_.push_back(t);
   }
 }
@@ -456,10 +629,12 @@ void initial_parasite_info::set_value(const YAML::Node &node) {
 
 void bitting_level_generator::set_value(const YAML::Node &node) {
   value_.level_density = config_->relative_bitting_info().v_biting_level_density;
+  value_.allocate();
 }
 
 void moving_level_generator::set_value(const YAML::Node &node) {
   value_.level_density = config_->circulation_info().v_moving_level_density;
+  value_.allocate();
 }
 
 void preconfig_population_events::set_value(const YAML::Node &node) {
@@ -7,6 +7,9 @@
 #include "Therapies/DrugDatabase.h"
 #include "Parasites/GenotypeDatabase.h"
 #include "Core/MultinomialDistributionGenerator.h"
+#include "Spatial/DistanceMatrix.h"
+#include "Core/FunctionTable.h"
+#include "Core/DoubleMatrix.h"
 
 namespace YAML {
 class Node;
@@ -40,13 +43,26 @@ class number_of_locations : public ConfigItem<unsigned long> {
   void set_value(const YAML::Node &node) override;
 };
 
-class spatial_distance_matrix : public ConfigItem<std::vector<std::vector<double>>> {
+class spatial_distance_matrix : public IConfigItem {
+ DISALLOW_COPY_AND_ASSIGN(spatial_distance_matrix)
+
+ DISALLOW_MOVE(spatial_distance_matrix)
+
  public:
-  spatial_distance_matrix(const std::string &name, const std::vector<std::vector<double>> &default_value,
-                          Config *config) : ConfigItem<std::
-                                                       vector<
-      std::vector<double>>>(
-      name, default_value, config) {}
+  Spatial::DistanceMatrix value_;
+  double default_cutoff_in_km_;
+ public:
+  //constructor
+  explicit spatial_distance_matrix(const std::string &name, const double &default_cutoff_in_km,
+                                   Config *config = nullptr) : IConfigItem(config, name),
+                                                               default_cutoff_in_km_{default_cutoff_in_km} {}
+
+  // destructor
+  virtual ~spatial_distance_matrix() = default;
+
+  virtual Spatial::DistanceMatrix &operator()() {
+    return value_;
+  }
 
   void set_value(const YAML::Node &node) override;
 };
@@ -75,6 +91,11 @@ class seasonal_info : public IConfigItem {
   }
 
   void set_value(const YAML::Node &node) override;
+
+ private:
+  double compute_factor(const int &location, const int &day_of_year) const;
+
+  void read_daily_factors(const std::string &file_name);
 };
 
 namespace Spatial {
@@ -128,6 +149,29 @@ class immune_system_information : public IConfigItem {
   void set_value(const YAML::Node &node) override;
 };
 
+class function_tables : public IConfigItem {
+ DISALLOW_COPY_AND_ASSIGN(function_tables)
+
+ DISALLOW_MOVE(function_tables)
+
+ public:
+  FunctionTables value_;
+ public:
+  //constructor
+  explicit function_tables(const std::string &name, FunctionTables default_value, Config *config = nullptr) :
+      IConfigItem(config, name),
+      value_{std::move(default_value)} {}
+
+  // destructor
+  virtual ~function_tables() = default;
+
+  virtual FunctionTables &operator()() {
+    return value_;
+  }
+
+  void set_value(const YAML::Node &node) override;
+};
+
 class genotype_db : public IConfigItem {
  DISALLOW_COPY_AND_ASSIGN(genotype_db)
 
@@ -189,10 +233,10 @@ class EC50_power_n_table : public IConfigItem {
  DISALLOW_MOVE(EC50_power_n_table)
 
  public:
-  DoubleVector2 value_;
+  DoubleMatrix value_;
  public:
   //constructor
-  explicit EC50_power_n_table(const std::string &name, DoubleVector2 default_value, Config *config = nullptr)
+  explicit EC50_power_n_table(const std::string &name, DoubleMatrix default_value, Config *config = nullptr)
       : IConfigItem(config, name),
         value_{
             std::move(default_value)
@@ -201,7 +245,7 @@ class EC50_power_n_table : public IConfigItem {
   // destructor
   virtual ~EC50_power_n_table() = default;
 
-  virtual DoubleVector2 &operator()() {
+  virtual DoubleMatrix &operator()() {
     return value_;
   }
 
@@ -0,0 +1,43 @@
+//
+// DoubleMatrix.cpp
+//
+
+#include "DoubleMatrix.h"
+
+DoubleMatrix::DoubleMatrix(const std::size_t &rows, const std::size_t &cols, const double &value) : rows_(rows),
+                                                                                                   cols_(cols),
+                                                                                                   values_(rows * cols,
+                                                                                                           value) {}
+
+DoubleMatrix::DoubleMatrix(const DoubleVector2 &nested) : rows_(nested.size()),
+                                                          cols_(nested.empty() ? 0 : nested[0].size()) {
+  values_.reserve(rows_ * cols_);
+  for (const auto &row : nested) {
+    values_.insert(values_.end(), row.begin(), row.end());
+  }
+}
+
+std::size_t DoubleMatrix::rows() const {
+  return rows_;
+}
+
+std::size_t DoubleMatrix::cols() const {
+  return cols_;
+}
+
+const DoubleVector &DoubleMatrix::values() const {
+  return values_;
+}
+
+DoubleVector2 DoubleMatrix::to_nested() const {
+  DoubleVector2 result;
+  result.reserve(rows_);
+  for (auto row = 0ul; row < rows_; row++) {
+    result.emplace_back(values_.begin() + row * cols_, values_.begin() + (row + 1) * cols_);
+  }
+  return result;
+}
+
+bool DoubleMatrix::operator==(const DoubleMatrix &other) const {
+  return rows_ == other.rows_ && cols_ == other.cols_ && values_ == other.values_;
+}
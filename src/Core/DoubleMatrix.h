@@ -0,0 +1,50 @@
+//
+// DoubleMatrix.h
+//
+
+#ifndef DOUBLEMATRIX_H
+#define DOUBLEMATRIX_H
+
+#include "Core/TypeDef.h"
+
+/**
+ * Row major rows x cols matrix of doubles in one contiguous buffer. matrix[row] is a pointer to the row, so elements
+ * are still written matrix[row][col].
+ */
+class DoubleMatrix {
+ public:
+  DoubleMatrix() = default;
+
+  DoubleMatrix(const std::size_t &rows, const std::size_t &cols, const double &value = 0.0);
+
+  explicit DoubleMatrix(const DoubleVector2 &nested);
+
+  virtual ~DoubleMatrix() = default;
+
+  double *operator[](const std::size_t &row) {
+    return values_.data() + row * cols_;
+  }
+
+  const double *operator[](const std::size_t &row) const {
+    return values_.data() + row * cols_;
+  }
+
+  std::size_t rows() const;
+
+  std::size_t cols() const;
+
+  const DoubleVector &values() const;
+
+  DoubleVector2 to_nested() const;
+
+  bool operator==(const DoubleMatrix &other) const;
+
+ private:
+  std::size_t rows_{0};
+
+  std::size_t cols_{0};
+
+  DoubleVector values_;
+};
+
+#endif // DOUBLEMATRIX_H
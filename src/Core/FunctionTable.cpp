@@ -0,0 +1,77 @@
+//
+// FunctionTable.cpp
+//
+
+#include <algorithm>
+#include <cmath>
+#include "FunctionTable.h"
+
+const int FunctionTable::INITIAL_NUMBER_OF_POINTS;
+
+void FunctionTable::build(const Function &function, const double &min, const double &max, const double &max_error,
+                          const int &max_points) {
+  function_ = function;
+  min_ = min;
+  max_ = max;
+  values_.clear();
+  max_error_ = 0;
+  if (max_error <= 0 || max <= min) {
+    return;
+  }
+
+  // the interpolation error shrinks 4 times each time the step is halved
+  for (auto number_of_points = INITIAL_NUMBER_OF_POINTS; number_of_points <= max_points;
+       number_of_points = 2 * number_of_points - 1) {
+    tabulate(number_of_points);
+    max_error_ = validate();
+    if (max_error_ <= max_error) {
+      return;
+    }
+  }
+
+  // not accurate enough, use the exact function
+  values_.clear();
+  max_error_ = 0;
+}
+
+double FunctionTable::exact(const double &x) const {
+  return function_(x);
+}
+
+double FunctionTable::validate(const int &number_of_samples) const {
+  if (values_.empty()) {
+    return 0;
+  }
+  auto result = 0.0;
+  for (auto i = 0; i <= number_of_samples; i++) {
+    const auto x = min_ + (max_ - min_) * i / number_of_samples;
+    result = std::max(result, std::fabs((*this)(x) - function_(x)));
+  }
+  const auto step = 1.0 / inverse_step_;
+  for (auto i = 0ul; i + 1 < values_.size(); i++) {
+    const auto x = min_ + (i + 0.5) * step;
+    result = std::max(result, std::fabs((*this)(x) - function_(x)));
+  }
+  return result;
+}
+
+bool FunctionTable::is_tabulated() const {
+  return !values_.empty();
+}
+
+std::size_t FunctionTable::number_of_points() const {
+  return values_.size();
+}
+
+double FunctionTable::max_error() const {
+  return max_error_;
+}
+
+void FunctionTable::tabulate(const int &number_of_points) {
+  values_.resize(number_of_points);
+  const auto step = (max_ - min_) / (number_of_points - 1);
+  inverse_step_ = 1.0 / step;
+  for (auto i = 0; i < number_of_points; i++) {
+    values_[i] = function_(min_ + i * step);
+  }
+}
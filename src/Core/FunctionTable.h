@@ -0,0 +1,89 @@
+//
+// FunctionTable.h
+//
+
+#ifndef FUNCTIONTABLE_H
+#define FUNCTIONTABLE_H
+
+#include <functional>
+#include <string>
+#include "Core/TypeDef.h"
+
+/**
+ * FunctionTable replaces a smooth function of one variable on [min, max] by linear interpolation between equally
+ * spaced points. build() doubles the number of points until the error measured against the exact function is below
+ * max_error, and falls back to exact evaluation when max_points are not enough (or when max_error <= 0). Arguments
+ * outside [min, max] are always evaluated exactly.
+ */
+class FunctionTable {
+ public:
+  typedef std::function<double(const double &)> Function;
+
+  static const int INITIAL_NUMBER_OF_POINTS = 257;
+
+ public:
+  FunctionTable() = default;
+
+  virtual ~FunctionTable() = default;
+
+  void build(const Function &function, const double &min, const double &max, const double &max_error,
+             const int &max_points);
+
+  double operator()(const double &x) const {
+    if (values_.empty() || x < min_ || x > max_) {
+      return function_(x);
+    }
+    const auto position = (x - min_) * inverse_step_;
+    auto index = static_cast<std::size_t>(position);
+    if (index >= values_.size() - 1) {
+      index = values_.size() - 2;
+    }
+    return values_[index] + (position - static_cast<double>(index)) * (values_[index + 1] - values_[index]);
+  }
+
+  /// exact evaluation
+  double exact(const double &x) const;
+
+  /**
+   * Validation harness: largest absolute difference with the exact function over number_of_samples equally spaced
+   * arguments of [min, max], plus the midpoints between table points where the interpolation error peaks.
+   */
+  double validate(const int &number_of_samples = 10007) const;
+
+  bool is_tabulated() const;
+
+  std::size_t number_of_points() const;
+
+  double max_error() const;
+
+ private:
+  void tabulate(const int &number_of_points);
+
+  Function function_;
+
+  double min_{0};
+
+  double max_{0};
+
+  double inverse_step_{0};
+
+  double max_error_{0};
+
+  DoubleVector values_;
+};
+
+/**
+ * Curves evaluated per person many times a day, tabulated from the config when it is read.
+ */
+struct FunctionTables {
+  /// relative infectivity of a log10 parasite density
+  FunctionTable relative_infectivity;
+
+  /// probability to progress to clinical given the immune level
+  FunctionTable clinical_progression;
+
+  /// exp(-x) for the growth and decay of the immune level
+  FunctionTable exp_minus;
+};
+
+#endif // FUNCTIONTABLE_H
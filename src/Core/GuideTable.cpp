@@ -0,0 +1,71 @@
+//
+// GuideTable.cpp
+//
+
+#include <algorithm>
+#include "GuideTable.h"
+
+GuideTable::GuideTable(const DoubleVector &weights) {
+  build(weights);
+}
+
+void GuideTable::build(const DoubleVector &weights) {
+  const auto n = weights.size();
+  cumulative_.resize(n);
+  is_monotone_ = true;
+  // same summation order as the scan so that the cumulative values are bit for bit the same
+  auto sum = 0.0;
+  for (auto i = 0ul; i < n; i++) {
+    sum += weights[i];
+    cumulative_[i] = sum;
+    is_monotone_ = is_monotone_ && weights[i] >= 0;
+  }
+
+  guide_.assign(n, n);
+  auto i = 0ul;
+  for (auto j = 0ul; j < n; j++) {
+    const auto lower = static_cast<double>(j) / n;
+    while (i < n && cumulative_[i] < lower) {
+      i++;
+    }
+    if (i == n) {
+      break;
+    }
+    guide_[j] = i;
+  }
+}
+
+std::size_t GuideTable::index(const double &p) const {
+  const auto n = cumulative_.size();
+  if (n == 0) {
+    return 0;
+  }
+
+  if (!is_monotone_) {
+    for (auto i = 0ul; i < n; i++) {
+      if (p <= cumulative_[i]) {
+        return i;
+      }
+    }
+    return n;
+  }
+
+  const auto j = std::min(n - 1, static_cast<std::size_t>(std::max(0.0, p) * n));
+  auto i = guide_[j];
+  // p * n may round across an interval boundary, step back to the first index the scan would stop at
+  while (i > 0 && p <= cumulative_[i - 1]) {
+    i--;
+  }
+  while (i < n && p > cumulative_[i]) {
+    i++;
+  }
+  return i;
+}
+
+std::size_t GuideTable::size() const {
+  return cumulative_.size();
+}
+
+bool GuideTable::empty() const {
+  return cumulative_.empty();
+}
@@ -0,0 +1,43 @@
+//
+// GuideTable.h
+//
+
+#ifndef GUIDETABLE_H
+#define GUIDETABLE_H
+
+#include <cstddef>
+#include "Core/TypeDef.h"
+
+/**
+ * GuideTable is the compiled form of the cumulative scan
+ *     sum = 0; for i: { sum += weights[i]; if (p <= sum) return i; } return size;
+ * For every 1/size interval of p it keeps the first index the scan can stop at (Chen and Asau's guide table), so a
+ * lookup costs O(1) on average and returns exactly the index of the scan for the same p. Negative weights make the
+ * cumulative sums non monotone, the table then falls back to the scan itself.
+ */
+class GuideTable {
+ public:
+  GuideTable() = default;
+
+  explicit GuideTable(const DoubleVector &weights);
+
+  virtual ~GuideTable() = default;
+
+  void build(const DoubleVector &weights);
+
+  /// index returned by the cumulative scan for p in [0, 1), size() when p is above the sum of the weights
+  std::size_t index(const double &p) const;
+
+  std::size_t size() const;
+
+  bool empty() const;
+
+ private:
+  DoubleVector cumulative_;
+
+  std::vector<std::size_t> guide_;
+
+  bool is_monotone_{true};
+};
+
+#endif // GUIDETABLE_H
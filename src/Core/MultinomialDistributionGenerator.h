@@ -9,6 +9,7 @@
 #define    MULTINOMIALDISTRIBUTIONGENERATOR_H
 
 #include "Core/TypeDef.h"
+#include "Core/AliasTable.h"
 
 class Random;
 
@@ -18,8 +19,8 @@ class MultinomialDistributionGenerator {
 
 
  public:
-  UIntVector data;
   DoubleVector level_density;
+  AliasTable table;
 
   MultinomialDistributionGenerator() = default;
 
@@ -35,7 +36,8 @@ class MultinomialDistributionGenerator {
 
   int draw_random_level(Random *random);
 
-  void allocate(Random *random);
+  /// rebuilds the alias table from level_density
+  void allocate();
 
 };
 
@@ -0,0 +1,49 @@
+//
+// MultinomialSampler.cpp
+//
+
+#include <algorithm>
+#include "MultinomialSampler.h"
+#include "Core/Random.h"
+
+MultinomialSampler::MultinomialSampler(const std::size_t &number_of_categories) : weights_(number_of_categories, 0.0),
+                                                                                  counts_(number_of_categories, 0) {}
+
+DoubleVector &MultinomialSampler::weights(const std::size_t &number_of_categories) {
+  weights_.resize(number_of_categories);
+  return weights_;
+}
+
+DoubleVector &MultinomialSampler::weights() {
+  return weights_;
+}
+
+const UIntVector &MultinomialSampler::sample(Random *random, const unsigned int &number_of_trials) {
+  return sample(random, weights_.data(), weights_.size(), number_of_trials);
+}
+
+const UIntVector &MultinomialSampler::sample(Random *random, const double *weights, const std::size_t &size,
+                                             const unsigned int &number_of_trials) {
+  counts_.assign(size, 0);
+
+  auto total_weight = 0.0;
+  for (auto k = 0ul; k < size; k++) {
+    total_weight += weights[k];
+  }
+
+  auto sum_weight = 0.0;
+  auto remaining_trials = number_of_trials;
+  for (auto k = 0ul; k < size && remaining_trials > 0; k++) {
+    if (weights[k] > 0.0) {
+      const auto p = std::min(1.0, weights[k] / (total_weight - sum_weight));
+      counts_[k] = static_cast<unsigned int>(random->random_binomial(p, remaining_trials));
+      remaining_trials -= counts_[k];
+    }
+    sum_weight += weights[k];
+  }
+  return counts_;
+}
+
+const UIntVector &MultinomialSampler::counts() const {
+  return counts_;
+}
@@ -0,0 +1,46 @@
+//
+// MultinomialSampler.h
+//
+
+#ifndef MULTINOMIALSAMPLER_H
+#define MULTINOMIALSAMPLER_H
+
+#include <cstddef>
+#include "Core/TypeDef.h"
+
+class Random;
+
+/**
+ * MultinomialSampler draws multinomial counts by conditional binomials (as gsl_ran_multinomial does) into buffers that
+ * are allocated once and reused, so that the daily draws in the population events do not allocate. Drawing stops as
+ * soon as every trial has been assigned.
+ *
+ * Usage: fill weights() (resized to the number of categories), then call sample(); or pass external weights.
+ */
+class MultinomialSampler {
+ public:
+  explicit MultinomialSampler(const std::size_t &number_of_categories = 0);
+
+  virtual ~MultinomialSampler() = default;
+
+  /// weights buffer of the given size, the previous content is kept
+  DoubleVector &weights(const std::size_t &number_of_categories);
+
+  DoubleVector &weights();
+
+  /// draws number_of_trials over the weights() buffer
+  const UIntVector &sample(Random *random, const unsigned int &number_of_trials);
+
+  /// draws number_of_trials over size external weights
+  const UIntVector &sample(Random *random, const double *weights, const std::size_t &size,
+                           const unsigned int &number_of_trials);
+
+  const UIntVector &counts() const;
+
+ private:
+  DoubleVector weights_;
+
+  UIntVector counts_;
+};
+
+#endif // MULTINOMIALSAMPLER_H
@@ -120,7 +120,7 @@ double Random::random_flat(const double &from, const double &to) {
   return gsl_ran_flat(G_RNG, from, to);
 }
 
-void Random::random_multinomial(const size_t &K, const unsigned &N, double p[], unsigned n[]) {
+void Random::random_multinomial(const size_t &K, const unsigned &N, const double p[], unsigned n[]) {
   gsl_ran_multinomial(G_RNG, K, N, p, n);
 }
 
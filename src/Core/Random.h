@@ -63,7 +63,7 @@ class Random {
 
   virtual double random_flat(const double &from, const double &to);
 
-  virtual void random_multinomial(const size_t &K, const unsigned &N, double p[], unsigned n[]);
+  virtual void random_multinomial(const size_t &K, const unsigned &N, const double p[], unsigned n[]);
 
   virtual void random_shuffle(void *base, size_t base_length, size_t size_of_type);
 
@@ -5,20 +5,24 @@
  * Created on March 22, 2013, 2:27 PM
  */
 
+#include <algorithm>
 #include <vector>
 #include "Scheduler.h"
 #include "Events/Event.h"
 #include "Dispatcher.h"
 #include "Model.h"
 #include "Core/Config/Config.h"
-#include "Helpers/TimeHelpers.h"
+#include "Population/Population.h"
+#include <fmt/format.h>
 #include "Helpers/ObjectHelpers.h"
 #include "easylogging++.h"
 
 using namespace date;
 
 Scheduler::Scheduler(Model* model) : current_time_(-1), total_available_time_(-1), model_(model),
-                                     is_force_stop_(false) { }
+                                     is_force_stop_(false), population_event_step_(1), infection_event_step_(1),
+                                     is_fast_forwarding_(false), number_of_fast_forwarded_days_(0),
+                                     number_of_quiescent_periods_(0), number_of_interrupted_quiescent_periods_(0) { }
 
 Scheduler::~Scheduler() {
   clear_all_events();
@@ -32,6 +36,7 @@ void Scheduler::extend_total_time(int new_total_time) {
     }
   }
   total_available_time_ = new_total_time;
+  calendar_.extend(new_total_time + 1);
 }
 
 void Scheduler::clear_all_events() {
@@ -45,6 +50,8 @@ void Scheduler::initialize(const date::year_month_day& starting_date, const int&
   set_current_time(0);
 
   calendar_date = sys_days(starting_date);
+  calendar_.initialize(calendar_date, total_available_time_ + 1);
+  today_ = calendar_.day_of(calendar_date);
 }
 
 void Scheduler::clear_all_events(EventPtrVector2& events_list) const {
@@ -119,9 +126,11 @@ void Scheduler::run() {
   LOG(INFO) << "Simulation is running";
   current_time_ = 0;
 
-  for (current_time_ = 0; !can_stop(); current_time_++) {
+  for (current_time_ = 0; !can_stop(); move_to_next_day()) {
     LOG_IF(current_time_ % 100 == 0, INFO) << "Day: " << current_time_;
     begin_time_step();
+    // before the population events of today are executed and removed
+    update_population_event_step();
     // population related events
     execute_events_list(population_events_list_[current_time_]);
     // population related events
@@ -130,8 +139,12 @@ void Scheduler::run() {
     execute_events_list(individual_events_list_[current_time_]);
 
     end_time_step();
-    calendar_date += days{1};
   }
+
+  LOG_IF(Model::CONFIG->using_adaptive_time_step(), INFO)
+      << fmt::format("Adaptive time step: {} days fast-forwarded in {} quiescent periods, {} of them ended by a case",
+                     number_of_fast_forwarded_days_, number_of_quiescent_periods_,
+                     number_of_interrupted_quiescent_periods_);
 }
 
 void Scheduler::begin_time_step() const {
@@ -154,32 +167,116 @@ void Scheduler::end_time_step() const {
   }
 }
 
+void Scheduler::update_population_event_step() {
+  if (!Model::CONFIG->using_tau_leaping() && !Model::CONFIG->using_adaptive_time_step()) {
+    population_event_step_ = 1;
+    infection_event_step_ = 1;
+    return;
+  }
+  if (Model::CONFIG->using_adaptive_time_step()) {
+    const auto has_0_case = Model::POPULATION->has_0_case();
+    if (is_fast_forwarding_ && current_time_ < next_population_event_step_time_ && !has_0_case) {
+      // a case ends the quiescent period: from today the force of infection is updated and the infections are drawn
+      // daily. The births, deaths and circulation of the remaining days were drawn on the first day of the period.
+      is_fast_forwarding_ = false;
+      is_drawing_daily_infections_ = true;
+      number_of_interrupted_quiescent_periods_++;
+    }
+    const auto inside_quiescent_period = is_fast_forwarding_ && current_time_ < next_population_event_step_time_;
+    number_of_days_without_case_ = inside_quiescent_period || has_0_case ? number_of_days_without_case_ + 1 : 0;
+  }
+  if (current_time_ < next_population_event_step_time_) {
+    // inside a leap or a quiescent period
+    population_event_step_ = 0;
+    infection_event_step_ = is_drawing_daily_infections_ ? 1 : 0;
+    if (is_fast_forwarding_) {
+      number_of_fast_forwarded_days_++;
+    }
+    return;
+  }
+  is_drawing_daily_infections_ = false;
+
+  // with no case over the tracking days the force of infection is 0 and no infection can happen before a population
+  // event. Such a quiescent period is fast-forwarded: the births, deaths and circulation are drawn once for the period
+  // and the force of infection is not updated. The persons are brought up to date by their own events, ages and
+  // immune values are evaluated in closed form.
+  is_fast_forwarding_ = Model::CONFIG->using_adaptive_time_step() && !has_population_event_stopping_step(current_time_)
+      && number_of_days_without_case_ > Model::CONFIG->number_of_tracking_days();
+  const auto max_step = is_fast_forwarding_ ? Model::CONFIG->adaptive_time_step_max_days()
+                                            : (Model::CONFIG->using_tau_leaping() ? Model::CONFIG->tau_leaping_step()
+                                                                                  : 1);
+
+  // a leap does not cover the days with population events (MDA, strategy or coverage changes, importations...),
+  // which are stepped daily, and stops at the end of the month so that the monthly data are not shifted. The periodic
+  // importation draws the cases of the whole leap itself and does not stop it.
+  population_event_step_ = 1;
+  if (!has_population_event_stopping_step(current_time_)) {
+    while (population_event_step_ < max_step
+        && current_time_ + population_event_step_ <= Model::CONFIG->total_time()
+        && !calendar_[current_time_ + population_event_step_].is_first_day_of_month
+        && !has_population_event_stopping_step(current_time_ + population_event_step_)) {
+      population_event_step_++;
+    }
+  }
+  if (is_fast_forwarding_ && population_event_step_ > 1) {
+    number_of_quiescent_periods_++;
+  } else {
+    is_fast_forwarding_ = false;
+  }
+  infection_event_step_ = population_event_step_;
+  next_population_event_step_time_ = current_time_ + population_event_step_;
+}
+
+int Scheduler::days_to_next_population_event_step() const {
+  if (!Model::CONFIG->using_tau_leaping() && !Model::CONFIG->using_adaptive_time_step()) {
+    return 1;
+  }
+  return std::max(1, next_population_event_step_time_ - current_time_);
+}
+
+bool Scheduler::has_population_event_stopping_step(const int &time) const {
+  for (auto* event : population_events_list_[time]) {
+    if (event->stops_population_event_step()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Scheduler::move_to_next_day() {
+  current_time_++;
+  calendar_date += days{1};
+  today_ = calendar_.day_of(calendar_date);
+}
+
 bool Scheduler::can_stop() const {
   return current_time_ > Model::CONFIG->total_time() || is_force_stop_;
 }
 
+int Scheduler::time_of(const date::sys_days &date) const {
+  return (date - calendar_.starting_date()).count();
+}
+
 int Scheduler::current_day_in_year() const {
-  return TimeHelpers::day_of_year(calendar_date);
+  return today().day_of_year;
+}
+
+int Scheduler::days_to_next_year() const {
+  return today().days_to_next_year;
 }
 
 bool Scheduler::is_today_last_day_of_year() const {
-  year_month_day ymd{calendar_date};
-  return ymd.month() == month{12} && ymd.day() == day{31};
+  return today().is_last_day_of_year;
 }
 
 bool Scheduler::is_today_first_day_of_month() const {
-  // return true;
-  year_month_day ymd{calendar_date};
-  return ymd.day() == day{1};
+  return today().is_first_day_of_month;
 }
 
 bool Scheduler::is_today_first_day_of_year() const {
-  year_month_day ymd{calendar_date};
-  return ymd.month() == month{1} && ymd.day() == day{1};
+  return today().is_first_day_of_year;
 }
 
 bool Scheduler::is_today_last_day_of_month() const {
-  const auto next_date = calendar_date + days{1};
-  year_month_day ymd{next_date};
-  return ymd.day() == day{1};
+  return today().is_last_day_of_month;
 }
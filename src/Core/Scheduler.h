@@ -12,6 +12,7 @@
 #include "date/date.h"
 #include "Core/PropertyMacro.h"
 #include "Core/TypeDef.h"
+#include "Core/SimulationCalendar.h"
 
 class Model;
 
@@ -28,6 +29,27 @@ class Scheduler {
 
  PROPERTY_REF(bool, is_force_stop)
 
+ READ_ONLY_PROPERTY_REF(SimulationCalendar, calendar)
+
+ // number of days whose population events (infections, births, deaths, circulation) are drawn today: 1 with daily
+ // stepping, up to tau_leaping_step on the first day of a tau leap and 0 on the other days of the leap
+ READ_ONLY_PROPERTY_REF(int, population_event_step)
+
+ // number of days whose infections are drawn today: population_event_step, except on the remaining days of a quiescent
+ // period ended by a case, whose infections are drawn daily
+ READ_ONLY_PROPERTY_REF(int, infection_event_step)
+
+ // adaptive time step: true on the days of a quiescent period, see update_population_event_step
+ READ_ONLY_PROPERTY_REF(bool, is_fast_forwarding)
+
+ // days of the quiescent periods whose population events and force of infection update were skipped
+ READ_ONLY_PROPERTY_REF(int, number_of_fast_forwarded_days)
+
+ READ_ONLY_PROPERTY_REF(int, number_of_quiescent_periods)
+
+ // quiescent periods ended before their last day by a case
+ READ_ONLY_PROPERTY_REF(int, number_of_interrupted_quiescent_periods)
+
  public:
   date::sys_days calendar_date;
 
@@ -64,8 +86,28 @@ class Scheduler {
 
   bool can_stop() const;
 
+  void update_population_event_step();
+
+  /// days from today to the next update of the population event step: 1 with daily stepping, the remaining days of the
+  /// tau leap or quiescent period otherwise
+  int days_to_next_population_event_step() const;
+
+  /// moves current_time, calendar_date and today() to the next day, at the end of each time step
+  void move_to_next_day();
+
+  /// calendar fields of calendar_date, read from the calendar each time the date moves
+  const SimulationCalendar::Day &today() const {
+    return today_;
+  }
+
+  /// simulation time of a calendar date
+  int time_of(const date::sys_days &date) const;
+
   int current_day_in_year() const;
 
+  /// days from calendar_date to the same date next year
+  int days_to_next_year() const;
+
   bool is_today_last_day_of_month() const;
 
   bool is_today_first_day_of_month() const;
@@ -74,6 +116,16 @@ class Scheduler {
 
   bool is_today_last_day_of_year() const;
 
+ private:
+  SimulationCalendar::Day today_;
+
+  bool has_population_event_stopping_step(const int &time) const;
+
+  int next_population_event_step_time_{0};
+
+  int number_of_days_without_case_{0};
+
+  bool is_drawing_daily_infections_{false};
 };
 
 #endif  /* SCHEDULER_H */
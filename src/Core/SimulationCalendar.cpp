@@ -0,0 +1,49 @@
+//
+// SimulationCalendar.cpp
+//
+
+#include "SimulationCalendar.h"
+#include "Helpers/TimeHelpers.h"
+
+void SimulationCalendar::initialize(const date::sys_days &starting_date, const int &number_of_days) {
+  starting_date_ = starting_date;
+  days_.clear();
+  extend(number_of_days);
+}
+
+void SimulationCalendar::extend(const int &number_of_days) {
+  days_.reserve(number_of_days);
+  for (auto i = static_cast<int>(days_.size()); i < number_of_days; i++) {
+    days_.push_back(compute(starting_date_ + date::days{i}));
+  }
+}
+
+int SimulationCalendar::number_of_days() const {
+  return static_cast<int>(days_.size());
+}
+
+const date::sys_days &SimulationCalendar::starting_date() const {
+  return starting_date_;
+}
+
+SimulationCalendar::Day SimulationCalendar::day_of(const date::sys_days &date) const {
+  const auto day_index = TimeHelpers::number_of_days(starting_date_, date);
+  return contains(day_index) ? days_[day_index] : compute(date);
+}
+
+SimulationCalendar::Day SimulationCalendar::compute(const date::sys_days &date) {
+  const date::year_month_day ymd{date};
+  const date::year_month_day next_ymd{date + date::days{1}};
+
+  Day result;
+  result.year = static_cast<int>(ymd.year());
+  result.month = static_cast<unsigned char>(static_cast<unsigned>(ymd.month()));
+  result.day = static_cast<unsigned char>(static_cast<unsigned>(ymd.day()));
+  result.day_of_year = static_cast<short>(TimeHelpers::day_of_year(date));
+  result.days_to_next_year = static_cast<short>(TimeHelpers::number_of_days_to_next_year(date));
+  result.is_first_day_of_month = ymd.day()==date::day{1};
+  result.is_first_day_of_year = result.is_first_day_of_month && ymd.month()==date::month{1};
+  result.is_last_day_of_month = next_ymd.day()==date::day{1};
+  result.is_last_day_of_year = ymd.month()==date::month{12} && ymd.day()==date::day{31};
+  return result;
+}
@@ -0,0 +1,84 @@
+//
+// SimulationCalendar.h
+//
+
+#ifndef SIMULATIONCALENDAR_H
+#define SIMULATIONCALENDAR_H
+
+#include <vector>
+#include "date/date.h"
+
+/**
+ * SimulationCalendar holds, for every day of the run (day 0 is the starting date), the calendar fields the model
+ * asks for each day, so that these queries are array reads instead of date conversions. Dates outside of the
+ * precomputed span are converted on the fly.
+ */
+class SimulationCalendar {
+ public:
+  struct Day {
+    int year{0};
+
+    unsigned char month{0};
+
+    unsigned char day{0};
+
+    // from 1 to 366
+    short day_of_year{0};
+
+    // days to the same date next year, see TimeHelpers::number_of_days_to_next_year
+    short days_to_next_year{0};
+
+    bool is_first_day_of_month{false};
+
+    bool is_first_day_of_year{false};
+
+    bool is_last_day_of_month{false};
+
+    bool is_last_day_of_year{false};
+
+    /// month and day as one comparable number, see SimulationCalendar::month_day
+    int month_day() const {
+      return SimulationCalendar::month_day(month, day);
+    }
+  };
+
+ public:
+  SimulationCalendar() = default;
+
+  virtual ~SimulationCalendar() = default;
+
+  /// precomputes days 0 to number_of_days - 1 from starting_date
+  void initialize(const date::sys_days &starting_date, const int &number_of_days);
+
+  /// precomputes more days when number_of_days is larger than the current span
+  void extend(const int &number_of_days);
+
+  const Day &operator[](const int &day_index) const {
+    return days_[day_index];
+  }
+
+  bool contains(const int &day_index) const {
+    return day_index >= 0 && day_index < static_cast<int>(days_.size());
+  }
+
+  int number_of_days() const;
+
+  const date::sys_days &starting_date() const;
+
+  /// fields of any date, read from the table when the date is in the span
+  Day day_of(const date::sys_days &date) const;
+
+  static Day compute(const date::sys_days &date);
+
+  /// orders the dates of a year (Feb 29 falls between Feb 28 and Mar 1)
+  static int month_day(const unsigned &month, const unsigned &day) {
+    return 100*static_cast<int>(month) + static_cast<int>(day);
+  }
+
+ private:
+  date::sys_days starting_date_;
+
+  std::vector<Day> days_;
+};
+
+#endif // SIMULATIONCALENDAR_H
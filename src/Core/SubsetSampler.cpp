@@ -0,0 +1,42 @@
+//
+// SubsetSampler.cpp
+//
+
+#include <algorithm>
+#include <numeric>
+#include "SubsetSampler.h"
+#include "Core/Random.h"
+
+const std::vector<std::size_t> &SubsetSampler::sample(Random *random, const std::size_t &n, const std::size_t &k) {
+  const auto number_of_draws = std::min(n, k);
+  positions_.resize(number_of_draws);
+
+  // the dense buffer costs n writes, worth it once a good part of the sequence is drawn
+  if (8 * number_of_draws > n) {
+    permutation_.resize(n);
+    std::iota(permutation_.begin(), permutation_.end(), 0);
+    for (auto i = 0ul; i < number_of_draws; i++) {
+      const auto j = random->random_uniform_int(i, n);
+      std::swap(permutation_[i], permutation_[j]);
+      positions_[i] = permutation_[i];
+    }
+    return positions_;
+  }
+
+  swapped_.clear();
+  for (auto i = 0ul; i < number_of_draws; i++) {
+    const auto j = random->random_uniform_int(i, n);
+    positions_[i] = value_at(j);
+    swapped_[j] = value_at(i);
+  }
+  return positions_;
+}
+
+const std::vector<std::size_t> &SubsetSampler::positions() const {
+  return positions_;
+}
+
+std::size_t SubsetSampler::value_at(const std::size_t &position) const {
+  const auto it = swapped_.find(position);
+  return it == swapped_.end() ? position : it->second;
+}
@@ -0,0 +1,41 @@
+//
+// SubsetSampler.h
+//
+
+#ifndef SUBSETSAMPLER_H
+#define SUBSETSAMPLER_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+class Random;
+
+/**
+ * SubsetSampler draws k distinct positions out of [0, n) uniformly (sampling without replacement) by a partial
+ * Fisher-Yates shuffle of the virtual sequence 0, 1, ..., n - 1, so that the sampled container itself is neither copied
+ * nor reordered. Only the k swaps are stored: in a hash map when k is small compared to n, in a dense permutation
+ * buffer otherwise. Both buffers are kept between calls.
+ */
+class SubsetSampler {
+ public:
+  SubsetSampler() = default;
+
+  virtual ~SubsetSampler() = default;
+
+  /// k (at most n) distinct positions of [0, n), in random order
+  const std::vector<std::size_t> &sample(Random *random, const std::size_t &n, const std::size_t &k);
+
+  const std::vector<std::size_t> &positions() const;
+
+ private:
+  std::size_t value_at(const std::size_t &position) const;
+
+  std::unordered_map<std::size_t, std::size_t> swapped_;
+
+  std::vector<std::size_t> permutation_;
+
+  std::vector<std::size_t> positions_;
+};
+
+#endif // SUBSETSAMPLER_H
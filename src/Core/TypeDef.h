@@ -13,6 +13,7 @@
 #include <map>
 #include <string>
 #include <ostream>
+#include <cstdint>
 
 class Person;
 
@@ -47,6 +48,11 @@ typedef std::vector<LongVector> LongVector2;
 typedef std::vector<std::string> StringVector;
 typedef std::vector<StringVector> StringVector2;
 
+// one bit per (locus, allele) of the genotype info, see Genotype::allele_bit
+typedef std::uint64_t AlleleBits;
+// one bit per drug type id
+typedef std::uint64_t DrugBits;
+
 typedef std::map<int, int> IntIntMap;
 
 typedef std::vector<Person*> PersonPtrVector;
@@ -63,12 +69,14 @@ typedef std::vector<Reporter*> ReporterPtrVector;
 
 typedef std::list<PersonIndex*> PersonIndexPtrList;
 
-typedef std::map<int, Drug*> DrugPtrMap;
 
 typedef std::vector<Therapy*> TherapyPtrVector;
 typedef std::vector<IStrategy*> StrategyPtrVector;
 
 struct SeasonalInfo {
+  // day_of_year goes from 1 to 366
+  static const int DAYS_IN_TABLE = 367;
+
   bool enable{false};
   DoubleVector A;
   DoubleVector B;
@@ -76,6 +84,14 @@ struct SeasonalInfo {
   DoubleVector phi;
   DoubleVector min_value;
 
+  // seasonal factor of [location][day_of_year], flattened, computed from the equation or read from
+  // daily_factors_file when the config is read; empty when seasonality is disabled
+  DoubleVector factors;
+
+  double get_factor(const int &location, const int &day_of_year) const {
+    return factors.empty() ? 1.0 : factors[location*DAYS_IN_TABLE + day_of_year];
+  }
+
   friend std::ostream &operator<<(std::ostream &os, const SeasonalInfo &seasonal_info);
 };
 
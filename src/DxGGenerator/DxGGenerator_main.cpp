@@ -28,6 +28,7 @@
 #include "Strategies/IStrategy.h"
 #include "Strategies/SFTStrategy.h"
 #include "Population/ImmuneSystem.h"
+#include "Population/PkPdCohort.h"
 #include "Events/ProgressToClinicalEvent.h"
 #include "MDC/ModelDataCollector.h"
 #include "Therapies/Therapy.h"
@@ -59,6 +60,8 @@ double as_ec50 = -1.0;
 
 std::string input_file = "input_DxG.yml";
 
+bool use_full_model = false;
+
 
 inline double round(double val) {
   if (val < 0) return ceil(val - 0.5);
@@ -99,6 +102,8 @@ int main(int argc, char** argv) {
       p_model->CONFIG->EC50_power_n_table()[0][0] = pow(as_ec50, p_model->CONFIG->drug_db()->at(0)->n());
   } 
 
+  PkPdCohort cohort(p_model->config(), p_model->random());
+
   // initialEC50Table
   std::vector<std::vector<double>> EC50_table(Model::CONFIG->genotype_db()->size(),
                                               std::vector<double>(Model::CONFIG->drug_db()->size(), 0));
@@ -150,7 +155,8 @@ int main(int argc, char** argv) {
       EF50Key key = get_EC50_key(therapy, p_genotype);
       auto search = efficacies.find(key);
       if (search == efficacies.end()) {
-        double efficacy = getEfficacyForTherapy(p_genotype, therapy_id, p_model);
+        double efficacy = use_full_model ? getEfficacyForTherapy(p_genotype, therapy_id, p_model)
+                                         : cohort.get_efficacy(p_genotype, therapy);
         ss << efficacy << "\t";
         efficacies.insert(std::make_pair(key, efficacy));
       } else {
@@ -207,6 +213,9 @@ void create_cli_option(CLI::App &app) {
                   "EC50 for AS on C580 only");
 
   app.add_option("-i,--input", input_file, "Input filename for DxG");
+
+  app.add_flag("--full-model", use_full_model,
+               "Get efficacies with a model run per genotype and therapy instead of the PK/PD cohort");
 }
 
 double getEfficacyForTherapy(Genotype* g, int therapy_id, Model* p_model) {
@@ -36,6 +36,11 @@ class Event : public IndexHandler {
 
   virtual std::string name() = 0;
 
+  /// population events that draw the days of a tau leap or a quiescent period themselves do not stop it
+  virtual bool stops_population_event_step() const {
+    return true;
+  }
+
  private:
   virtual void execute() = 0;
 
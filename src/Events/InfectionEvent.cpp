@@ -0,0 +1,34 @@
+//
+// InfectionEvent.cpp
+//
+
+#include "InfectionEvent.h"
+#include "Model.h"
+#include "Core/Scheduler.h"
+#include "MDC/ModelDataCollector.h"
+#include "Population/Person.h"
+
+OBJECTPOOL_IMPL(InfectionEvent)
+
+InfectionEvent::InfectionEvent() : parasite_type_id_(-1) {}
+
+InfectionEvent::~InfectionEvent() = default;
+
+void InfectionEvent::schedule_event(Scheduler *scheduler, Person *p, const int &parasite_type_id, const int &time) {
+  if (scheduler!=nullptr) {
+    auto *e = new InfectionEvent();
+    e->dispatcher = p;
+    e->set_parasite_type_id(parasite_type_id);
+    e->time = time;
+    p->add(e);
+    scheduler->schedule_individual_event(e);
+  }
+}
+
+void InfectionEvent::execute() {
+  auto *person = dynamic_cast<Person *>(dispatcher);
+  if (person->host_state()==Person::EXPOSED || person->liver_parasite_type()!=nullptr) return;
+
+  Model::DATA_COLLECTOR->monthly_number_of_new_infections_by_location()[person->location()] += 1;
+  person->infected_by(parasite_type_id_);
+}
@@ -0,0 +1,45 @@
+//
+// InfectionEvent.h
+//
+
+#ifndef INFECTIONEVENT_H
+#define INFECTIONEVENT_H
+
+#include "Event.h"
+#include "Core/ObjectPool.h"
+#include "Core/PropertyMacro.h"
+#include <string>
+
+class Scheduler;
+
+class Person;
+
+/**
+ * Infection by an infectious bite drawn in a tau leap, performed on a random day of the leap. As with the daily
+ * infections, the bite is lost when the person already has a parasite in the liver on that day.
+ */
+class InfectionEvent : public Event {
+ DISALLOW_COPY_AND_ASSIGN(InfectionEvent)
+
+ DISALLOW_MOVE(InfectionEvent)
+
+ OBJECTPOOL(InfectionEvent)
+
+ PROPERTY_REF(int, parasite_type_id)
+
+ public:
+  InfectionEvent();
+
+  virtual ~InfectionEvent();
+
+  static void schedule_event(Scheduler *scheduler, Person *p, const int &parasite_type_id, const int &time);
+
+  std::string name() override {
+    return "InfectionEvent";
+  }
+
+ private:
+  void execute() override;
+};
+
+#endif // INFECTIONEVENT_H
@@ -0,0 +1,32 @@
+//
+// BirthEvent.cpp
+//
+
+#include "BirthEvent.h"
+#include "Constants.h"
+#include "Model.h"
+#include "Core/Scheduler.h"
+#include "MDC/ModelDataCollector.h"
+#include "Population/Population.h"
+
+OBJECTPOOL_IMPL(BirthEvent)
+
+BirthEvent::BirthEvent() : location_(-1) {}
+
+BirthEvent::~BirthEvent() = default;
+
+void BirthEvent::schedule_event(Scheduler *scheduler, const int &location, const int &execute_at) {
+  if (scheduler!=nullptr) {
+    auto *e = new BirthEvent();
+    e->dispatcher = nullptr;
+    e->set_location(location);
+    e->time = execute_at;
+    scheduler->schedule_population_event(e);
+  }
+}
+
+void BirthEvent::execute() {
+  Model::POPULATION->give_1_birth(location_);
+  Model::DATA_COLLECTOR->update_person_days_by_years(location_, Constants::DAYS_IN_YEAR() -
+      Model::SCHEDULER->current_day_in_year());
+}
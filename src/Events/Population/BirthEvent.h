@@ -0,0 +1,41 @@
+//
+// BirthEvent.h
+//
+
+#ifndef BIRTHEVENT_H
+#define BIRTHEVENT_H
+
+#include "Core/ObjectPool.h"
+#include "Core/PropertyMacro.h"
+#include "Events/Event.h"
+#include <string>
+
+/**
+ * Birth drawn in a tau leap or a quiescent period, given on a random day of the period so that the ages (and the
+ * maternal immunity) of the newborns are the same as with daily births.
+ */
+class BirthEvent : public Event {
+ DISALLOW_COPY_AND_ASSIGN(BirthEvent)
+
+ DISALLOW_MOVE(BirthEvent)
+
+ OBJECTPOOL(BirthEvent)
+
+ PROPERTY_REF(int, location)
+
+ public:
+  BirthEvent();
+
+  virtual ~BirthEvent();
+
+  static void schedule_event(Scheduler *scheduler, const int &location, const int &execute_at);
+
+  std::string name() override {
+    return "BirthEvent";
+  }
+
+ private:
+  void execute() override;
+};
+
+#endif // BIRTHEVENT_H
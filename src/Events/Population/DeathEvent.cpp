@@ -0,0 +1,51 @@
+//
+// DeathEvent.cpp
+//
+
+#include "DeathEvent.h"
+#include "Model.h"
+#include "Core/Random.h"
+#include "Core/Scheduler.h"
+#include "Population/Person.h"
+#include "Population/Population.h"
+#include "Population/Properties/PersonIndexByLocationStateAgeClass.h"
+
+OBJECTPOOL_IMPL(DeathEvent)
+
+DeathEvent::DeathEvent() : location_(-1), age_class_(-1) {}
+
+DeathEvent::~DeathEvent() = default;
+
+void DeathEvent::schedule_event(Scheduler *scheduler, const int &location, const int &age_class,
+                                const int &execute_at) {
+  if (scheduler!=nullptr) {
+    auto *e = new DeathEvent();
+    e->dispatcher = nullptr;
+    e->set_location(location);
+    e->set_age_class(age_class);
+    e->time = execute_at;
+    scheduler->schedule_population_event(e);
+  }
+}
+
+void DeathEvent::execute() {
+  auto *pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
+
+  // any living person of the location and age class, whatever the host state
+  std::size_t size = 0;
+  for (auto hs = 0; hs < Person::DEAD; hs++) {
+    size += pi->vPerson()[location_][hs][age_class_].size();
+  }
+  if (size==0) return;
+
+  auto index = Model::RANDOM->random_uniform(size);
+  auto hs = 0;
+  while (index >= pi->vPerson()[location_][hs][age_class_].size()) {
+    index -= pi->vPerson()[location_][hs][age_class_].size();
+    hs++;
+  }
+  auto *p = pi->vPerson()[location_][hs][age_class_][index];
+  p->cancel_all_events_except(nullptr);
+  p->set_host_state(Person::DEAD);
+  Model::POPULATION->remove_dead_person(p);
+}
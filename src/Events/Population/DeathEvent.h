@@ -0,0 +1,43 @@
+//
+// DeathEvent.h
+//
+
+#ifndef DEATHEVENT_H
+#define DEATHEVENT_H
+
+#include "Core/ObjectPool.h"
+#include "Core/PropertyMacro.h"
+#include "Events/Event.h"
+#include <string>
+
+/**
+ * Background death drawn in a tau leap or a quiescent period, given on a random day of the period to a person of the
+ * location and age class still alive on that day, as with daily deaths.
+ */
+class DeathEvent : public Event {
+ DISALLOW_COPY_AND_ASSIGN(DeathEvent)
+
+ DISALLOW_MOVE(DeathEvent)
+
+ OBJECTPOOL(DeathEvent)
+
+ PROPERTY_REF(int, location)
+
+ PROPERTY_REF(int, age_class)
+
+ public:
+  DeathEvent();
+
+  virtual ~DeathEvent();
+
+  static void schedule_event(Scheduler *scheduler, const int &location, const int &age_class, const int &execute_at);
+
+  std::string name() override {
+    return "DeathEvent";
+  }
+
+ private:
+  void execute() override;
+};
+
+#endif // DEATHEVENT_H
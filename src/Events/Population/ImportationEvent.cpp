@@ -7,11 +7,8 @@
 
 #include "ImportationEvent.h"
 #include "Model.h"
-#include "Population/Population.h"
-#include "Population/ImmuneSystem.h"
-#include "Core/Config/Config.h"
 #include "Core/Random.h"
-#include "Population/Properties/PersonIndexByLocationStateAgeClass.h"
+#include "Population/ParasiteImporter.h"
 
 OBJECTPOOL_IMPL(ImportationEvent)
 
@@ -41,30 +38,7 @@ void ImportationEvent::schedule_event(Scheduler* scheduler, const int &location,
 
 void ImportationEvent::execute() {
   const auto number_of_importation_cases = Model::RANDOM->random_poisson(number_of_cases_);
-  auto* pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
-
-  for (auto i = 0; i < number_of_importation_cases; i++) {
-
-    const size_t ind_ac = Model::RANDOM->random_uniform(static_cast<unsigned long>(pi->vPerson()[0][0].size()));
-    if (pi->vPerson()[0][0][ind_ac].empty()) {
-      continue;
-    }
-    const size_t index = Model::RANDOM->random_uniform(pi->vPerson()[0][0][ind_ac].size());
-    auto* p = pi->vPerson()[0][0][ind_ac][index];
-
-    p->immune_system()->set_increase(true);
-    p->set_host_state(Person::ASYMPTOMATIC);
-
-    auto* blood_parasite = p->add_new_parasite_to_blood(Model::CONFIG->genotype_db()
-                                                            ->at(static_cast<const unsigned long &>(genotype_id_)));
-
-    auto size = Model::CONFIG->parasite_density_level().log_parasite_density_asymptomatic;
-
-    blood_parasite->set_gametocyte_level(Model::CONFIG->gametocyte_level_full());
-    blood_parasite->set_last_update_log10_parasite_density(size);
-    blood_parasite->set_update_function(Model::MODEL->immunity_clearance_update_function());
-
-    //        Model::POPULATION->initial_infection(pi->vPerson()[0][0][ind_ac][index], Model::CONFIG->parasite_db()->get(0));
-  }
 
+  const ImportationSpec spec(location_, number_of_cases_, IntVector{genotype_id_}, DoubleVector{1.0});
+  ParasiteImporter::import(spec, number_of_importation_cases);
 }
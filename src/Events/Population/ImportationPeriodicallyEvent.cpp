@@ -7,13 +7,11 @@
 
 #include "ImportationPeriodicallyEvent.h"
 #include "Model.h"
-#include "Population/Population.h"
-#include "Population/ImmuneSystem.h"
-#include "Population/ClonalParasitePopulation.h"
 #include "Core/Config/Config.h"
 #include "Core/Random.h"
+#include "Core/Scheduler.h"
 #include "MDC/ModelDataCollector.h"
-#include "Population/Properties/PersonIndexByLocationStateAgeClass.h"
+#include "Population/ParasiteImporter.h"
 #include <easylogging++.h>
 
 OBJECTPOOL_IMPL(ImportationPeriodicallyEvent)
@@ -46,60 +44,74 @@ void ImportationPeriodicallyEvent::schedule_event(Scheduler* scheduler, const in
 
 void ImportationPeriodicallyEvent::execute() {
   // std::cout << date::year_month_day{ Model::SCHEDULER->calendar_date } << ":import periodically event" << std::endl;
-  //schedule importation for the next day
-  schedule_event(Model::SCHEDULER, location_, duration_, genotype_id_, number_of_cases_,
-                 Model::SCHEDULER->current_time() + 1);
+  if (number_of_leaped_cases_ >= 0) {
+    import(number_of_leaped_cases_);
+    return;
+  }
+  if (spec_==nullptr) {
+    spec_ = std::make_shared<const ImportationSpec>(build_spec());
+  }
+
+  // the cases of every day up to the next step of the population events are drawn at once (only today's cases with
+  // daily stepping), and the importation is scheduled again for the first day of the next step, with the same spec
+  const auto number_of_days = Model::SCHEDULER->days_to_next_population_event_step();
+  auto* next_event = new ImportationPeriodicallyEvent(location_, duration_, genotype_id_, number_of_cases_,
+                                                     Model::SCHEDULER->current_time() + number_of_days);
+  next_event->dispatcher = nullptr;
+  next_event->spec_ = spec_;
+  Model::SCHEDULER->schedule_population_event(next_event);
 
   const auto number_of_importation_cases = Model::RANDOM->random_poisson(
-      static_cast<double>(number_of_cases_)/duration_);
-  if (Model::DATA_COLLECTOR->popsize_by_location_hoststate()[location_][0] < number_of_importation_cases) {
+      static_cast<double>(number_of_cases_)/duration_*number_of_days);
+  if (number_of_days==1) {
+    import(number_of_importation_cases);
     return;
   }
 
-  //    std::cout << number_of_cases_ << std::endl;
-  auto* pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
-  VLOG_IF(number_of_importation_cases > 0, 2) << "Day: " << Model::SCHEDULER->current_time() << " - Importing "
-                                              << number_of_importation_cases
-                                              << " at location " << location_
-                                              << " with genotype " << genotype_id_;
+  // the cases of a tau leap or a quiescent period are imported on random days of it, as the births
+  IntVector cases_by_day(number_of_days, 0);
   for (auto i = 0; i < number_of_importation_cases; i++) {
+    cases_by_day[static_cast<int>(Model::RANDOM->random_uniform(number_of_days))]++;
+  }
+  import(cases_by_day[0]);
+  for (auto day = 1; day < number_of_days; day++) {
+    if (cases_by_day[day]==0) continue;
+    auto* day_event = new ImportationPeriodicallyEvent(location_, duration_, genotype_id_, number_of_cases_,
+                                                      Model::SCHEDULER->current_time() + day);
+    day_event->dispatcher = nullptr;
+    day_event->spec_ = spec_;
+    day_event->number_of_leaped_cases_ = cases_by_day[day];
+    Model::SCHEDULER->schedule_population_event(day_event);
+  }
+}
 
-    std::size_t ind_ac = Model::RANDOM->random_uniform(static_cast<unsigned long>(pi->vPerson()[location_][0].size()));
-    if (pi->vPerson()[location_][0][ind_ac].empty()) {
-      continue;
-    }
-
-    std::size_t index = Model::RANDOM->random_uniform(pi->vPerson()[location_][0][ind_ac].size());
-    auto* p = pi->vPerson()[location_][0][ind_ac][index];
-
-    p->immune_system()->set_increase(true);
-    p->set_host_state(Person::ASYMPTOMATIC);
-
-    //check and draw random Genotype
-    Genotype* imported_genotype = nullptr;
-    if (genotype_id_==-1) {
-      ul random_id = Model::RANDOM->random_uniform_int(0,
-                                                       static_cast<const unsigned long &>(Model::CONFIG
-                                                           ->number_of_parasite_types()));
-
-//      new genotype will have 50% change of 580Y and 50% plasmepsin-2 copy, last allele will always be x
-      if (random_id%2==1) {
-        random_id -= 1;
-      }
-      imported_genotype = Model::CONFIG->genotype_db()->at(random_id);
-    } else {
-      imported_genotype = Model::CONFIG->genotype_db()->at(genotype_id_);
-    }
+void ImportationPeriodicallyEvent::import(const int &number_of_importation_cases) const {
+  if (number_of_importation_cases==0
+      || Model::DATA_COLLECTOR->popsize_by_location_hoststate()[location_][0] < number_of_importation_cases) {
+    return;
+  }
 
-    auto* blood_parasite = p->add_new_parasite_to_blood(imported_genotype);
-    //    std::cout << "hello"<< std::endl;
+  VLOG(2) << "Day: " << Model::SCHEDULER->current_time() << " - Importing " << number_of_importation_cases
+          << " at location " << location_ << " with genotype " << genotype_id_;
 
-    auto size = Model::CONFIG->parasite_density_level().log_parasite_density_asymptomatic;
+  ParasiteImporter::import(*spec_, number_of_importation_cases);
+}
 
-    blood_parasite->set_gametocyte_level(Model::CONFIG->gametocyte_level_full());
-    blood_parasite->set_last_update_log10_parasite_density(size);
-    blood_parasite->set_update_function(Model::MODEL->immunity_clearance_update_function());
+ImportationSpec ImportationPeriodicallyEvent::build_spec() const {
+  const auto daily_number_of_cases = static_cast<double>(number_of_cases_)/duration_;
+  if (genotype_id_!=-1) {
+    return ImportationSpec(location_, daily_number_of_cases, IntVector{static_cast<int>(genotype_id_)},
+                           DoubleVector{1.0});
+  }
 
-    //        Model::POPULATION->initial_infection(pi->vPerson()[0][0][ind_ac][index], Model::CONFIG->parasite_db()->get(0));
+  // new genotype will have 50% change of 580Y and 50% plasmepsin-2 copy, last allele will always be x:
+  // a uniform id with the odd ids moved to the even id below
+  IntVector genotype_ids;
+  DoubleVector genotype_weights;
+  const auto number_of_parasite_types = Model::CONFIG->number_of_parasite_types();
+  for (auto id = 0; id < number_of_parasite_types; id += 2) {
+    genotype_ids.push_back(id);
+    genotype_weights.push_back(id + 1 < number_of_parasite_types ? 2.0 : 1.0);
   }
+  return ImportationSpec(location_, daily_number_of_cases, genotype_ids, genotype_weights);
 }
@@ -8,10 +8,13 @@
 #ifndef IMPORTATIONPERIODICALLYEVENT_H
 #define    IMPORTATIONPERIODICALLYEVENT_H
 
+#include <memory>
 #include "Core/ObjectPool.h"
 #include "Core/PropertyMacro.h"
 #include "Events/Event.h"
 
+struct ImportationSpec;
+
 class ImportationPeriodicallyEvent : public Event {
  DISALLOW_COPY_AND_ASSIGN(ImportationPeriodicallyEvent)
 
@@ -39,9 +42,25 @@ class ImportationPeriodicallyEvent : public Event {
     return "ImportationPeriodicallyEvent";
   }
 
+  /// the cases of a tau leap or a quiescent period are drawn on its first day and spread over its days
+  bool stops_population_event_step() const override {
+    return false;
+  }
+
  private:
   void execute() override;
 
+  /// cases of one day
+  ImportationSpec build_spec() const;
+
+  void import(const int &number_of_importation_cases) const;
+
+  // built by the first execution and handed over to the event of the next day, so that the genotype sampler is only
+  // built once per importation
+  std::shared_ptr<const ImportationSpec> spec_;
+
+  // cases drawn for this day by the first day of a tau leap, -1 for the periodic event itself
+  int number_of_leaped_cases_{-1};
 };
 
 #endif    /* IMPORTATIONPERIODICALLYEVENT_H */
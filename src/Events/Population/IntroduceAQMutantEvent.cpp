@@ -1,10 +1,8 @@
 #include "IntroduceAQMutantEvent.h"
-#include "Population/Properties/PersonIndexByLocationStateAgeClass.h"
 #include "Model.h"
 #include "Population/Population.h"
 #include "Core/Config/Config.h"
-#include "Core/Random.h"
-#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Population/ParasiteImporter.h"
 
 IntroduceAQMutantEvent::IntroduceAQMutantEvent(const int& location, const int& execute_at, const double& fraction) :
   location_(location),
@@ -15,47 +13,10 @@ IntroduceAQMutantEvent::IntroduceAQMutantEvent(const int& location, const int& e
 IntroduceAQMutantEvent::~IntroduceAQMutantEvent() = default;
 
 void IntroduceAQMutantEvent::execute() {
-  auto* pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
-
-
-  for (auto j = 0; j < Model::CONFIG->number_of_age_classes(); ++j) {
-//    static const std::vector<int> mutant_alleles{0, 1, 3, 4, 5, 7};
-
-
-    const auto number_infected_individual_in_ac =
-      pi->vPerson()[0][Person::ASYMPTOMATIC][j].size() + pi->vPerson()[0][Person::CLINICAL][j].size();
-    const auto number_of_importation_cases = Model::RANDOM->random_poisson(
-      number_infected_individual_in_ac * fraction_);
-    if (number_of_importation_cases == 0)
-      continue;
-    for (auto i = 0; i < number_of_importation_cases; i++) {
-
-      const auto index = Model::RANDOM->random_uniform(number_infected_individual_in_ac);
-
-      Person* p = nullptr;
-      if (index < pi->vPerson()[0][Person::ASYMPTOMATIC][j].size()) {
-        p = pi->vPerson()[0][Person::ASYMPTOMATIC][j][index];
-      }
-      else {
-        p = pi->vPerson()[0][Person::CLINICAL][j][index - pi->vPerson()[0][Person::ASYMPTOMATIC][j].size()];
-      }
-
-      for (auto* pp : *(p->all_clonal_parasite_populations()->parasites())) {
-        auto* old_genotype = pp->genotype();
-
-        // old mutation mechanism
-//        auto* new_genotype = old_genotype->combine_mutation_to(0, 1);
-//        // 0, 1,3,4,5,7
-//        const auto allele_index = Model::RANDOM->random_uniform(mutant_alleles.size());
-//        new_genotype = new_genotype->combine_mutation_to(1, mutant_alleles[allele_index]);
-
-        //5b scenarios
-        auto* new_genotype = Model::CONFIG->genotype_db()->at(72);
-
-        pp->set_genotype(new_genotype);
-      }
-    }
-  }
+  // 5b scenarios
+  ParasiteImporter::convert(location_, fraction_, [](Genotype*) {
+    return Model::CONFIG->genotype_db()->at(72);
+  });
 
   LOG(INFO) << date::year_month_day{scheduler->calendar_date} << " : " << this->name();
 }
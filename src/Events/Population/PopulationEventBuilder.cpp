@@ -104,14 +104,24 @@ std::vector<Event*> PopulationEventBuilder::build_single_round_mda_event(const Y
   for (std::size_t i = 0; i < node.size(); i++) {
     const auto starting_date = node[i]["day"].as<date::year_month_day>();
     auto time = (date::sys_days{starting_date} - date::sys_days{config->starting_date()}).count();
-    auto* e = new SingleRoundMDAEvent(time);
-    for (std::size_t loc = 0; loc < config->number_of_locations(); loc++) {
-      auto input_loc = node[i]["fraction_population_targeted"].size() < config->number_of_locations() ? 0 : loc;
-      e->fraction_population_targeted.push_back(node[i]["fraction_population_targeted"][input_loc].as<double>());
-    }
 
-    e->days_to_complete_all_treatments = node[i]["days_to_complete_all_treatments"].as<int>();
-    events.push_back(e);
+    // a campaign of several rounds repeats the same MDA every days_between_rounds
+    const auto number_of_rounds = node[i]["number_of_rounds"] ? node[i]["number_of_rounds"].as<int>() : 1;
+    const auto days_between_rounds = node[i]["days_between_rounds"] ? node[i]["days_between_rounds"].as<int>() : 0;
+
+    for (auto round = 0; round < number_of_rounds; round++) {
+      auto* e = new SingleRoundMDAEvent(time + round * days_between_rounds);
+      for (std::size_t loc = 0; loc < config->number_of_locations(); loc++) {
+        auto input_loc = node[i]["fraction_population_targeted"].size() < config->number_of_locations() ? 0 : loc;
+        e->fraction_population_targeted.push_back(node[i]["fraction_population_targeted"][input_loc].as<double>());
+      }
+
+      e->days_to_complete_all_treatments = node[i]["days_to_complete_all_treatments"].as<int>();
+      if (node[i]["age_classes_targeted"]) {
+        e->age_classes_targeted = node[i]["age_classes_targeted"].as<std::vector<int>>();
+      }
+      events.push_back(e);
+    }
   }
 
   return events;
@@ -1,5 +1,6 @@
 #define NOMINMAX
 
+#include <algorithm>
 #include "SingleRoundMDAEvent.h"
 #include "easylogging++.h"
 #include "Model.h"
@@ -10,6 +11,12 @@
 #include "Core/Random.h"
 #include "Events/ReceiveMDATherapyEvent.h"
 
+SubsetSampler SingleRoundMDAEvent::sampler_;
+
+std::vector<PersonPtrVector *> SingleRoundMDAEvent::buckets_;
+
+std::vector<std::size_t> SingleRoundMDAEvent::cumulative_sizes_;
+
 SingleRoundMDAEvent::SingleRoundMDAEvent(const int &execute_at) {
   time = execute_at;
 }
@@ -17,21 +24,27 @@ SingleRoundMDAEvent::SingleRoundMDAEvent(const int &execute_at) {
 void SingleRoundMDAEvent::execute() {
   LOG(INFO) << date::year_month_day{scheduler->calendar_date} << ": executing Single Round MDA";
 
+  auto pi_lsa = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
+  auto *therapy = Model::CONFIG->therapy_db()[Model::CONFIG->mda_therapy_id()];
 
   // for all location
   for (auto loc = 0; loc < Model::CONFIG->number_of_locations(); loc++) {
-    // step 1: get number of individuals for MDA
-    auto pi_lsa = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
-    std::vector<Person *> all_persons_in_location;
+    // step 1: get number of individuals for MDA, the targeted persons are seen as the concatenation of the
+    // (host state, age class) lists of the index, cumulative_sizes_[b] is the number of persons before bucket b
+    buckets_.clear();
+    cumulative_sizes_.clear();
+    std::size_t number_indidividuals_in_location = 0;
     for (auto hs = 0; hs < Person::DEAD; hs++) {
       for (auto ac = 0; ac < Model::CONFIG->number_of_age_classes(); ac++) {
-        for (auto p : pi_lsa->vPerson()[loc][hs][ac]) {
-          all_persons_in_location.push_back(p);
+        if (!is_age_class_targeted(ac) || pi_lsa->vPerson()[loc][hs][ac].empty()) {
+          continue;
         }
+        buckets_.push_back(&pi_lsa->vPerson()[loc][hs][ac]);
+        cumulative_sizes_.push_back(number_indidividuals_in_location);
+        number_indidividuals_in_location += buckets_.back()->size();
       }
     }
 
-    const auto number_indidividuals_in_location = all_persons_in_location.size();
     auto number_of_individuals_will_receive_mda = Model::RANDOM->random_poisson(
         fraction_population_targeted[loc]*number_indidividuals_in_location);
 
@@ -39,16 +52,19 @@ void SingleRoundMDAEvent::execute() {
         number_of_individuals_will_receive_mda > number_indidividuals_in_location
         ? number_indidividuals_in_location
         : number_of_individuals_will_receive_mda;
-    //shuffle app_persons_in_location index for sampling without replacement
-    Model::RANDOM->shuffle(&all_persons_in_location[0], all_persons_in_location.size(), sizeof(size_t));
 
-    for (auto p_i = 0; p_i < number_of_individuals_will_receive_mda; p_i++) {
-      auto p = all_persons_in_location[p_i];
+    // sampling without replacement, the index itself is left untouched
+    const auto &positions = sampler_.sample(Model::RANDOM, number_indidividuals_in_location,
+                                            number_of_individuals_will_receive_mda);
+
+    for (auto position : positions) {
+      const auto bucket = std::upper_bound(cumulative_sizes_.begin(), cumulative_sizes_.end(), position)
+          - cumulative_sizes_.begin() - 1;
+      auto p = (*buckets_[bucket])[position - cumulative_sizes_[bucket]];
       //step 2: determine whether person will receive treatment
       const auto prob = Model::RANDOM->random_flat(0.0, 1.0);
       if (prob < p->prob_present_at_mda()) {
         // receive MDA
-        auto *therapy = Model::CONFIG->therapy_db()[Model::CONFIG->mda_therapy_id()];
         // schedule received therapy in within days_to_complete_all_treatments
         int days_to_receive_mda_therapy = Model::RANDOM->random_uniform(days_to_complete_all_treatments) + 1;
         ReceiveMDATherapyEvent::schedule_event(Model::SCHEDULER, p, therapy,
@@ -60,3 +76,8 @@ void SingleRoundMDAEvent::execute() {
   }
 
 }
+
+bool SingleRoundMDAEvent::is_age_class_targeted(const int &age_class) const {
+  return age_classes_targeted.empty()
+      || std::find(age_classes_targeted.begin(), age_classes_targeted.end(), age_class) != age_classes_targeted.end();
+}
@@ -4,6 +4,8 @@
 #include "Events/Event.h"
 #include <vector>
 #include "Core/PropertyMacro.h"
+#include "Core/SubsetSampler.h"
+#include "Core/TypeDef.h"
 
 class SingleRoundMDAEvent : public Event {
  DISALLOW_COPY_AND_ASSIGN(SingleRoundMDAEvent)
@@ -14,6 +16,9 @@ class SingleRoundMDAEvent : public Event {
   std::vector<double> fraction_population_targeted;
   int days_to_complete_all_treatments{14};
 
+  /// age classes (of the person index) covered by the MDA, every age class when empty
+  std::vector<int> age_classes_targeted;
+
   explicit SingleRoundMDAEvent(const int &execute_at);
 
   virtual ~SingleRoundMDAEvent() = default;
@@ -24,6 +29,15 @@ class SingleRoundMDAEvent : public Event {
 
  private:
   void execute() override;
+
+  bool is_age_class_targeted(const int &age_class) const;
+
+  // scratch shared by all the rounds
+  static SubsetSampler sampler_;
+
+  static std::vector<PersonPtrVector *> buckets_;
+
+  static std::vector<std::size_t> cumulative_sizes_;
 };
 
 #endif // SINGLEROUNDMDAEVENT_H
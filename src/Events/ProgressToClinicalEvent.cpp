@@ -46,9 +46,7 @@ void ProgressToClinicalEvent::execute() {
   //    Random* random = model->random();
   //    Config* config = model->config();
 
-  const auto density = Model::RANDOM->random_uniform_double(
-      Model::CONFIG->parasite_density_level().log_parasite_density_clinical_from,
-      Model::CONFIG->parasite_density_level().log_parasite_density_clinical_to);
+  const auto density = draw_clinical_log10_parasite_density(*Model::CONFIG, *Model::RANDOM);
 
   clinical_caused_parasite_->set_last_update_log10_parasite_density(density);
 
@@ -145,6 +143,11 @@ void ProgressToClinicalEvent::schedule_event(Scheduler *scheduler, Person *p,
   }
 }
 
+double ProgressToClinicalEvent::draw_clinical_log10_parasite_density(Config &config, Random &random) {
+  return random.random_uniform_double(config.parasite_density_level().log_parasite_density_clinical_from,
+                                      config.parasite_density_level().log_parasite_density_clinical_to);
+}
+
 void ProgressToClinicalEvent::receive_no_treatment_routine(Person *p) {
   if (p->will_progress_to_death_when_receive_no_treatment()) {
     p->cancel_all_events_except(nullptr);
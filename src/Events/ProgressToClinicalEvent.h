@@ -19,6 +19,10 @@ class Scheduler;
 
 class ClonalParasitePopulation;
 
+class Config;
+
+class Random;
+
 class ProgressToClinicalEvent : public Event {
  OBJECTPOOL(ProgressToClinicalEvent)
 
@@ -38,6 +42,9 @@ class ProgressToClinicalEvent : public Event {
 
   static void receive_no_treatment_routine(Person *p);
 
+  /// log10 parasite density of the clone that causes the clinical episode
+  static double draw_clinical_log10_parasite_density(Config &config, Random &random);
+
   std::string name() override {
     return "ProgressToClinicalEvent";
   }
@@ -10,6 +10,7 @@
 #include "Core/Scheduler.h"
 #include "Model.h"
 #include "Core/Config/Config.h"
+#include "Population/Population.h"
 
 OBJECTPOOL_IMPL(UpdateEveryKDaysEvent)
 
@@ -30,5 +31,10 @@ void UpdateEveryKDaysEvent::schedule_event(Scheduler *scheduler, Person *p, cons
 
 void UpdateEveryKDaysEvent::execute() {
   auto *person = static_cast<Person *>(dispatcher);
+  if (Model::CONFIG->using_hybrid_compartmental_mode() && person->can_join_compartment()) {
+    // the updates resume when the person leaves the compartment
+    Model::POPULATION->move_to_compartment(person);
+    return;
+  }
   person->schedule_update_every_K_days_event(Model::CONFIG->update_frequency());
 }
@@ -61,10 +61,9 @@ inline int TimeHelpers::number_of_days_to_next_year(const date::sys_days &today)
 
 inline int TimeHelpers::get_simulation_time_birthday(const int &days_to_next_birthday, const int &age,
                                                      const date::sys_days &starting_day) {
-  const auto calendar_birthday = date::floor<date::days>(
-      starting_day + date::days{days_to_next_birthday + 1} - date::years{age + 1});
-
-  return number_of_days(starting_day, calendar_birthday);
+  // same as flooring starting_day + days{days_to_next_birthday + 1} - years{age + 1} to days, where a year is
+  // 146097/400 days, without the date conversions
+  return days_to_next_birthday + 1 - static_cast<int>((static_cast<long>(age + 1)*146097 + 399)/400);
 
 }
 
@@ -0,0 +1,84 @@
+//
+// GenotypeCensus.cpp
+//
+
+#include "GenotypeCensus.h"
+#include "Population/Person.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Parasites/Genotype.h"
+
+void GenotypeCensus::initialize(const int &number_of_locations, const int &number_of_genotypes) {
+  number_of_infected_hosts_by_location_ = IntVector(number_of_locations, 0);
+  number_of_clones_by_location_ = IntVector(number_of_locations, 0);
+  number_of_hosts_by_location_genotype_ = IntVector2(number_of_locations, IntVector(number_of_genotypes, 0));
+  number_of_clones_by_location_genotype_ = IntVector2(number_of_locations, IntVector(number_of_genotypes, 0));
+  number_of_clones_by_location_genotype_moi_ = IntVector3(number_of_locations, IntVector2(number_of_genotypes));
+}
+
+bool GenotypeCensus::is_initialized() const {
+  return !number_of_infected_hosts_by_location_.empty();
+}
+
+void GenotypeCensus::add_host(Person *person) {
+  update_host(person, 1);
+}
+
+void GenotypeCensus::remove_host(Person *person) {
+  update_host(person, -1);
+}
+
+void GenotypeCensus::update_host(Person *person, const int &sign) {
+  if (!is_initialized() || person == nullptr || person->location() < 0) { return; }
+  // a dead host has been removed from the census when its parasites were cleared (see Person::set_host_state),
+  // it is no longer counted until the population releases it
+  if (person->host_state() == Person::DEAD) { return; }
+
+  auto* parasites = person->all_clonal_parasite_populations()->parasites();
+  const int moi = static_cast<int>(parasites->size());
+  if (moi == 0) { return; }
+
+  const auto loc = person->location();
+  number_of_infected_hosts_by_location_[loc] += sign;
+  number_of_clones_by_location_[loc] += sign * moi;
+
+  // multiplicity of infection is small, a quadratic scan avoids any allocation
+  for (auto i = 0; i < moi; i++) {
+    const auto g_id = (*parasites)[i]->genotype()->genotype_id();
+
+    auto counted_before = false;
+    for (auto j = 0; j < i; j++) {
+      if ((*parasites)[j]->genotype()->genotype_id() == g_id) {
+        counted_before = true;
+        break;
+      }
+    }
+    if (counted_before) { continue; }
+
+    auto count = 1;
+    for (auto j = i + 1; j < moi; j++) {
+      if ((*parasites)[j]->genotype()->genotype_id() == g_id) {
+        count++;
+      }
+    }
+
+    number_of_hosts_by_location_genotype_[loc][g_id] += sign;
+    number_of_clones_by_location_genotype_[loc][g_id] += sign * count;
+
+    auto &by_moi = number_of_clones_by_location_genotype_moi_[loc][g_id];
+    if (by_moi.size() <= static_cast<std::size_t>(moi)) {
+      by_moi.resize(moi + 1, 0);
+    }
+    by_moi[moi] += sign * count;
+  }
+}
+
+double GenotypeCensus::weighted_number_of_hosts(const int &location, const int &genotype_id) const {
+  const auto &by_moi = number_of_clones_by_location_genotype_moi_[location][genotype_id];
+  auto result = 0.0;
+  for (auto moi = 1ul; moi < by_moi.size(); moi++) {
+    if (by_moi[moi] == 0) { continue; }
+    result += by_moi[moi] / static_cast<double>(moi);
+  }
+  return result;
+}
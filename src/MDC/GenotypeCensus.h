@@ -0,0 +1,63 @@
+//
+// GenotypeCensus.h
+//
+
+#ifndef GENOTYPECENSUS_H
+#define GENOTYPECENSUS_H
+
+#include "Core/PropertyMacro.h"
+#include "Core/TypeDef.h"
+
+class Person;
+
+/**
+ * GenotypeCensus keeps per-location genotype counts up to date as clonal parasite populations are added to or
+ * removed from a host, change genotype, or move with their host to another location. It is the incremental
+ * counterpart of scanning every person's parasites, so genotype frequency reports cost
+ * O(locations x genotypes) regardless of population size.
+ *
+ * Callers bracket every change to a host's parasites (or location) by remove_host() before the change and
+ * add_host() after it, see SingleHostClonalParasitePopulations. Hosts in the DEAD state are never counted.
+ */
+class GenotypeCensus {
+ DISALLOW_COPY_AND_ASSIGN(GenotypeCensus)
+
+ DISALLOW_MOVE(GenotypeCensus)
+
+  // number of hosts carrying at least one clonal parasite population
+ READ_ONLY_PROPERTY_REF(IntVector, number_of_infected_hosts_by_location)
+
+  // total number of clonal parasite populations
+ READ_ONLY_PROPERTY_REF(IntVector, number_of_clones_by_location)
+
+  // number of hosts carrying at least one clone of genotype g
+ READ_ONLY_PROPERTY_REF(IntVector2, number_of_hosts_by_location_genotype)
+
+  // number of clones of genotype g
+ READ_ONLY_PROPERTY_REF(IntVector2, number_of_clones_by_location_genotype)
+
+  // [loc][g][moi]: number of clones of genotype g in hosts having exactly moi clones,
+  // kept as integers so that the weighted frequency does not drift over a long run
+ READ_ONLY_PROPERTY_REF(IntVector3, number_of_clones_by_location_genotype_moi)
+
+ public:
+  GenotypeCensus() = default;
+
+  virtual ~GenotypeCensus() = default;
+
+  void initialize(const int &number_of_locations, const int &number_of_genotypes);
+
+  bool is_initialized() const;
+
+  void add_host(Person *person);
+
+  void remove_host(Person *person);
+
+  /// sum over infected hosts of (number of clones of genotype g / total number of clones in that host)
+  double weighted_number_of_hosts(const int &location, const int &genotype_id) const;
+
+ private:
+  void update_host(Person *person, const int &sign);
+};
+
+#endif // GENOTYPECENSUS_H
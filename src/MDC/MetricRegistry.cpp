@@ -0,0 +1,19 @@
+//
+// MetricRegistry.cpp
+//
+
+#include "MetricRegistry.h"
+
+MetricRegistry::MetricRegistry() : required_(NUMBER_OF_METRICS, false) {}
+
+void MetricRegistry::require(const Metric &metric) {
+  required_[metric] = true;
+}
+
+void MetricRegistry::require_all() {
+  required_.assign(NUMBER_OF_METRICS, true);
+}
+
+bool MetricRegistry::is_required(const Metric &metric) const {
+  return required_[metric];
+}
@@ -0,0 +1,60 @@
+//
+// MetricRegistry.h
+//
+
+#ifndef METRICREGISTRY_H
+#define METRICREGISTRY_H
+
+#include <vector>
+#include "Core/PropertyMacro.h"
+
+/**
+ * MetricRegistry records which optional metrics of the ModelDataCollector are read by the active reporters.
+ * Reporters declare what they need in their initialize() (which runs before ModelDataCollector::initialize()),
+ * and the collector skips the bookkeeping of every metric that nobody requires.
+ *
+ * Metrics the model itself depends on (e.g. the treatment failure rates used by the strategies, EIR, prevalence
+ * by location and age class) are always maintained and are not listed here.
+ */
+class MetricRegistry {
+ DISALLOW_COPY_AND_ASSIGN(MetricRegistry)
+
+ DISALLOW_MOVE(MetricRegistry)
+
+ public:
+  enum Metric {
+    // AMU/AFU accumulators in record_AMU_AFU
+    AMU_AFU = 0,
+    // percentage_bites_on_top_20_by_location
+    PERCENTAGE_BITES_ON_TOP_20,
+    // per-location genotype counts used by the genotype frequency outputs
+    GENOTYPE_CENSUS,
+    // the _by_5 age groups used by get_blood_slide_prevalence for ages above 10
+    AGE_GROUP_BY_5,
+    // counts by single year of age: popsize, deaths, malaria deaths, treatments and untreated cases
+    BY_AGE_YEAR,
+    // last_10_* series of prevalence and fraction of clinical
+    LAST_10_REPORTS,
+    // total_immune_by_location and total_immune_by_location_age_class
+    IMMUNITY,
+    // multiple_of_infection_by_location and mean_moi
+    MULTIPLICITY_OF_INFECTION,
+    NUMBER_OF_METRICS
+  };
+
+ public:
+  MetricRegistry();
+
+  virtual ~MetricRegistry() = default;
+
+  void require(const Metric &metric);
+
+  void require_all();
+
+  bool is_required(const Metric &metric) const;
+
+ private:
+  std::vector<bool> required_;
+};
+
+#endif // METRICREGISTRY_H
@@ -20,7 +20,8 @@
 #include "Population/ClonalParasitePopulation.h"
 #include "Constants.h"
 
-ModelDataCollector::ModelDataCollector(Model* model) : model_(model), current_utl_duration_(0),
+ModelDataCollector::ModelDataCollector(Model* model) : model_(model), popsize_residence_by_location_version_(0),
+                                                       current_utl_duration_(0),
                                                        AMU_per_parasite_pop_(0),
                                                        AMU_per_person_(0), AMU_for_clinical_caused_parasite_(0),
                                                        AFU_(0), discounted_AMU_per_parasite_pop_(0),
@@ -102,7 +103,9 @@ void ModelDataCollector::initialize() {
             0
         ));
 
-    average_number_biten_by_location_person_ = DoubleVector2(Model::CONFIG->number_of_locations(), DoubleVector());
+    average_number_biten_by_location_ = std::vector<TopShareSketch>(
+        Model::CONFIG->number_of_locations(),
+        TopShareSketch(Model::CONFIG->bitten_top_20_relative_error()));
     percentage_bites_on_top_20_by_location_ = DoubleVector(Model::CONFIG->number_of_locations(), 0.0);
 
     cumulative_discounted_NTF_by_location_ = DoubleVector(Model::CONFIG->number_of_locations(), 0.0);
@@ -114,15 +117,15 @@ void ModelDataCollector::initialize() {
     today_number_of_treatments_by_location_ = IntVector(Model::CONFIG->number_of_locations(), 0);
     today_RITF_by_location_ = IntVector(Model::CONFIG->number_of_locations(), 0);
 
-    total_number_of_treatments_60_by_location_ = IntVector2(
+    total_number_of_treatments_60_by_location_ = IntSlidingWindowVector(
         Model::CONFIG->number_of_locations(),
-        IntVector(Model::CONFIG->tf_window_size(), 0));
-    total_RITF_60_by_location_ = IntVector2(
+        SlidingWindow<int>(Model::CONFIG->tf_window_size(), 0));
+    total_RITF_60_by_location_ = IntSlidingWindowVector(
         Model::CONFIG->number_of_locations(),
-        IntVector(Model::CONFIG->tf_window_size(), 0));
-    total_TF_60_by_location_ = IntVector2(
+        SlidingWindow<int>(Model::CONFIG->tf_window_size(), 0));
+    total_TF_60_by_location_ = IntSlidingWindowVector(
         Model::CONFIG->number_of_locations(),
-        IntVector(Model::CONFIG->tf_window_size(), 0));
+        SlidingWindow<int>(Model::CONFIG->tf_window_size(), 0));
 
     current_RITF_by_location_ = DoubleVector(Model::CONFIG->number_of_locations(), 0.0);
     current_TF_by_location_ = DoubleVector(Model::CONFIG->number_of_locations(), 0.0);
@@ -155,18 +158,18 @@ void ModelDataCollector::initialize() {
     current_EIR_by_location_ = DoubleVector(Model::CONFIG->number_of_locations(), 0.0);
     last_update_total_number_of_bites_by_location_ = LongVector(Model::CONFIG->number_of_locations(), 0);
 
-    last_10_blood_slide_prevalence_by_location_ = DoubleVector2(
+    last_10_blood_slide_prevalence_by_location_ = DoubleSlidingWindowVector(
         Model::CONFIG->number_of_locations(),
-        DoubleVector(10, 0.0));
-    last_10_fraction_positive_that_are_clinical_by_location_ = DoubleVector2(
+        SlidingWindow<double>(10, 0.0));
+    last_10_fraction_positive_that_are_clinical_by_location_ = DoubleSlidingWindowVector(
         Model::CONFIG->number_of_locations(),
-        DoubleVector(10, 0.0));
-    last_10_fraction_positive_that_are_clinical_by_location_age_class_ = DoubleVector3(
+        SlidingWindow<double>(10, 0.0));
+    last_10_fraction_positive_that_are_clinical_by_location_age_class_ = DoubleSlidingWindowVector2(
         Model::CONFIG->number_of_locations(),
-        DoubleVector2(Model::CONFIG->number_of_age_classes(), DoubleVector(10, 0.0)));
-    last_10_fraction_positive_that_are_clinical_by_location_age_class_by_5_ = DoubleVector3(
+        DoubleSlidingWindowVector(Model::CONFIG->number_of_age_classes(), SlidingWindow<double>(10, 0.0)));
+    last_10_fraction_positive_that_are_clinical_by_location_age_class_by_5_ = DoubleSlidingWindowVector2(
         Model::CONFIG->number_of_locations(),
-        DoubleVector2(Model::CONFIG->number_of_age_classes(), DoubleVector(10, 0.0)));
+        DoubleSlidingWindowVector(Model::CONFIG->number_of_age_classes(), SlidingWindow<double>(10, 0.0)));
     total_parasite_population_by_location_ = IntVector(Model::CONFIG->number_of_locations(), 0);
     number_of_positive_by_location_ = IntVector(Model::CONFIG->number_of_locations(), 0);
 
@@ -212,12 +215,12 @@ void ModelDataCollector::initialize() {
     art_resistance_frequency_at_15_ = 0;
     total_resistance_frequency_at_15_ = 0;
 
-    total_number_of_treatments_60_by_therapy_ = IntVector2(
+    total_number_of_treatments_60_by_therapy_ = IntSlidingWindowVector(
         Model::CONFIG->therapy_db().size(),
-        IntVector(Model::CONFIG->tf_window_size(), 0));
-    total_tf_60_by_therapy_ = IntVector2(
+        SlidingWindow<int>(Model::CONFIG->tf_window_size(), 0));
+    total_tf_60_by_therapy_ = IntSlidingWindowVector(
         Model::CONFIG->therapy_db().size(),
-        IntVector(Model::CONFIG->tf_window_size(), 0));
+        SlidingWindow<int>(Model::CONFIG->tf_window_size(), 0));
     current_tf_by_therapy_ = DoubleVector(Model::CONFIG->therapy_db().size(), 0.0);
     today_tf_by_therapy_ = IntVector(Model::CONFIG->therapy_db().size(), 0);
     today_number_of_treatments_by_therapy_ = IntVector(Model::CONFIG->therapy_db().size(), 0);
@@ -230,6 +233,10 @@ void ModelDataCollector::initialize() {
 
     current_number_of_mutation_events_in_this_year_ = 0;
     number_of_mutation_events_by_year_ = LongVector();
+
+    if (metric_registry_.is_required(MetricRegistry::GENOTYPE_CENSUS)) {
+      genotype_census_.initialize(Model::CONFIG->number_of_locations(), Model::CONFIG->number_of_parasite_types());
+    }
   }
 }
 
@@ -289,9 +296,18 @@ void ModelDataCollector::perform_population_statistic() {
     }
   }
 
+  // popsize_residence_by_location is recounted below
+  popsize_residence_by_location_version_++;
+
   auto* pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
   long long sum_moi = 0;
 
+  const auto collect_immunity = metric_registry_.is_required(MetricRegistry::IMMUNITY);
+  const auto collect_by_5 = metric_registry_.is_required(MetricRegistry::AGE_GROUP_BY_5);
+  const auto collect_by_age_year = metric_registry_.is_required(MetricRegistry::BY_AGE_YEAR);
+  const auto collect_moi = metric_registry_.is_required(MetricRegistry::MULTIPLICITY_OF_INFECTION);
+  const auto collect_last_10 = metric_registry_.is_required(MetricRegistry::LAST_10_REPORTS);
+
   for (auto loc = 0ul; loc < Model::CONFIG->number_of_locations(); loc++) {
     auto pop_sum_location = 0;
     for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
@@ -308,12 +324,18 @@ void ModelDataCollector::perform_population_statistic() {
           //                    assert(p->has_birthday_event());
           //                    assert(p->age_class() == ac);
           //this immune value will include maternal immunity value of the infants
-          double immune_value = p->immune_system()->get_lastest_immune_value();
-          total_immune_by_location_[loc] += immune_value;
-          total_immune_by_location_age_class_[loc][ac] += immune_value;
+          if (collect_immunity) {
+            // persons held in a compartment are not updated, their immune value is evaluated now
+            double immune_value = p->in_compartment() ? p->immune_system()->get_current_value()
+                                                      : p->immune_system()->get_lastest_immune_value();
+            total_immune_by_location_[loc] += immune_value;
+            total_immune_by_location_age_class_[loc][ac] += immune_value;
+          }
           //                    popsize_by_location_age_class_[loc][ac] += 1;
           int ac1 = (p->age() > 70) ? 14 : p->age() / 5;
-          popsize_by_location_age_class_by_5_[loc][ac1] += 1;
+          if (collect_by_5) {
+            popsize_by_location_age_class_by_5_[loc][ac1] += 1;
+          }
 
           if (hs == Person::ASYMPTOMATIC) {
             number_of_positive_by_location_[loc]++;
@@ -322,16 +344,20 @@ void ModelDataCollector::perform_population_statistic() {
             if (p->has_detectable_parasite()) {
               blood_slide_prevalence_by_location_[loc] += 1;
               blood_slide_number_by_location_age_group_[loc][ac] += 1;
-              blood_slide_number_by_location_age_group_by_5_[loc][ac1] += 1;
+              if (collect_by_5) {
+                blood_slide_number_by_location_age_group_by_5_[loc][ac1] += 1;
+              }
             }
           } else if (hs == Person::CLINICAL) {
             number_of_positive_by_location_[loc]++;
             number_of_positive_by_location_age_group_[loc][ac] += 1;
             blood_slide_prevalence_by_location_[loc] += 1;
             blood_slide_number_by_location_age_group_[loc][ac] += 1;
-            blood_slide_number_by_location_age_group_by_5_[loc][ac1] += 1;
             number_of_clinical_by_location_age_group_[loc][ac] += 1;
-            number_of_clinical_by_location_age_group_by_5_[loc][ac1] += 1;
+            if (collect_by_5) {
+              blood_slide_number_by_location_age_group_by_5_[loc][ac1] += 1;
+              number_of_clinical_by_location_age_group_by_5_[loc][ac1] += 1;
+            }
           }
 
           int moi = p->all_clonal_parasite_populations()->size();
@@ -344,15 +370,17 @@ void ModelDataCollector::perform_population_statistic() {
 
             if (moi > number_of_reported_MOI) {
               //                            multiple_of_infection_by_location_[loc][number_of_reported_MOI - 1]++;
-            } else {
+            } else if (collect_moi) {
               multiple_of_infection_by_location_[loc][moi - 1]++;
             }
           }
 
-          if (p->age() < 79) {
-            popsize_by_location_age_[loc][p->age()] += 1;
-          } else {
-            popsize_by_location_age_[loc][79] += 1;
+          if (collect_by_age_year) {
+            if (p->age() < 79) {
+              popsize_by_location_age_[loc][p->age()] += 1;
+            } else {
+              popsize_by_location_age_[loc][79] += 1;
+            }
           }
         }
       }
@@ -385,32 +413,36 @@ void ModelDataCollector::perform_population_statistic() {
         static_cast<double>(popsize_by_location_[loc]);
     last_update_total_number_of_bites_by_location_[loc] = total_number_of_bites_by_location_[loc];
 
-    last_10_blood_slide_prevalence_by_location_[loc][
-        (Model::SCHEDULER->current_time() / Model::CONFIG->report_frequency()) %
-        10] = blood_slide_prevalence_by_location_[loc];
-    last_10_fraction_positive_that_are_clinical_by_location_[loc][
-        (Model::SCHEDULER->current_time() / Model::CONFIG->report_frequency()) %
-        10] = fraction_of_positive_that_are_clinical_by_location_[loc];
+    const auto report_index = Model::SCHEDULER->current_time() / Model::CONFIG->report_frequency();
+    if (collect_last_10) {
+      last_10_blood_slide_prevalence_by_location_[loc].set(report_index, blood_slide_prevalence_by_location_[loc]);
+      last_10_fraction_positive_that_are_clinical_by_location_[loc].set(
+          report_index, fraction_of_positive_that_are_clinical_by_location_[loc]);
+    }
 
     for (int ac = 0; ac < Model::CONFIG->number_of_age_classes(); ac++) {
-      last_10_fraction_positive_that_are_clinical_by_location_age_class_[loc][ac][
-          (Model::SCHEDULER->current_time() / Model::CONFIG->report_frequency()) %
-          10] = (blood_slide_prevalence_by_location_age_group_[loc][ac] == 0)
-                ? 0
-                : number_of_clinical_by_location_age_group_[loc][ac] /
-                  static_cast<double>(blood_slide_prevalence_by_location_age_group_[loc][ac]);
-      last_10_fraction_positive_that_are_clinical_by_location_age_class_by_5_[loc][ac][
-          (Model::SCHEDULER->current_time() / Model::CONFIG->report_frequency()) %
-          10] = (number_of_blood_slide_positive == 0)
-                ? 0
-                : number_of_clinical_by_location_age_group_by_5_[loc][ac] /
-                  number_of_blood_slide_positive;
+      if (collect_last_10) {
+        last_10_fraction_positive_that_are_clinical_by_location_age_class_[loc][ac].set(
+            report_index,
+            (blood_slide_prevalence_by_location_age_group_[loc][ac] == 0)
+            ? 0
+            : number_of_clinical_by_location_age_group_[loc][ac] /
+              static_cast<double>(blood_slide_prevalence_by_location_age_group_[loc][ac]));
+        last_10_fraction_positive_that_are_clinical_by_location_age_class_by_5_[loc][ac].set(
+            report_index,
+            (number_of_blood_slide_positive == 0)
+            ? 0
+            : number_of_clinical_by_location_age_group_by_5_[loc][ac] /
+              number_of_blood_slide_positive);
+      }
       blood_slide_prevalence_by_location_age_group_[loc][ac] =
           blood_slide_number_by_location_age_group_[loc][ac] /
           static_cast<double>(popsize_by_location_age_class_[loc][ac]);
-      blood_slide_prevalence_by_location_age_group_by_5_[loc][ac] =
-          blood_slide_number_by_location_age_group_by_5_[loc][ac] /
-          static_cast<double>(popsize_by_location_age_class_by_5_[loc][ac]);
+      if (collect_by_5) {
+        blood_slide_prevalence_by_location_age_group_by_5_[loc][ac] =
+            blood_slide_number_by_location_age_group_by_5_[loc][ac] /
+            static_cast<double>(popsize_by_location_age_class_by_5_[loc][ac]);
+      }
     }
   }
 }
@@ -442,12 +474,13 @@ void ModelDataCollector::perform_yearly_update() {
       // and also when the individual change location
       person_days_by_location_year_[loc] = Model::POPULATION->size(loc) * Constants::DAYS_IN_YEAR();
       total_number_of_bites_by_location_year_[loc] = 0;
-      for (auto age = 0; age < 80; age++) {
-        number_of_untreated_cases_by_location_age_year_[loc][age] = 0;
-        number_of_treatments_by_location_age_year_[loc][age] = 0;
-        number_of_deaths_by_location_age_year_[loc][age] = 0;
-        number_of_malaria_deaths_by_location_age_year_[loc][age] = 0;
-
+      if (metric_registry_.is_required(MetricRegistry::BY_AGE_YEAR)) {
+        for (auto age = 0; age < 80; age++) {
+          number_of_untreated_cases_by_location_age_year_[loc][age] = 0;
+          number_of_treatments_by_location_age_year_[loc][age] = 0;
+          number_of_deaths_by_location_age_year_[loc][age] = 0;
+          number_of_malaria_deaths_by_location_age_year_[loc][age] = 0;
+        }
       }
     }
     if (Model::SCHEDULER->current_time() >= Model::CONFIG->start_of_comparison_period()) {
@@ -513,17 +546,24 @@ void ModelDataCollector::record_1_death(
 ) {
   if (Model::SCHEDULER->current_time() >= Model::CONFIG->start_collect_data_day()) {
     update_person_days_by_years(location, -(Constants::DAYS_IN_YEAR() - Model::SCHEDULER->current_day_in_year()));
-    update_average_number_bitten(location, birthday, number_of_times_bitten);
+    if (metric_registry_.is_required(MetricRegistry::PERCENTAGE_BITES_ON_TOP_20)) {
+      update_average_number_bitten(location, birthday, number_of_times_bitten);
+    }
     number_of_death_by_location_age_group_[location][age_group] += 1;
-    if (age < 79) {
-      number_of_deaths_by_location_age_year_[location][age] += 1;
-    } else {
-      number_of_deaths_by_location_age_year_[location][79] += 1;
+    if (metric_registry_.is_required(MetricRegistry::BY_AGE_YEAR)) {
+      if (age < 79) {
+        number_of_deaths_by_location_age_year_[location][age] += 1;
+      } else {
+        number_of_deaths_by_location_age_year_[location][79] += 1;
+      }
     }
   }
 }
 
 void ModelDataCollector::record_1_malaria_death(const int& location, const int& age) {
+  if (!metric_registry_.is_required(MetricRegistry::BY_AGE_YEAR)) {
+    return;
+  }
   if (Model::SCHEDULER->current_time() >= Model::CONFIG->start_collect_data_day()) {
     if (age < 79) {
       number_of_malaria_deaths_by_location_age_year_[location][age] += 1;
@@ -545,10 +585,13 @@ void ModelDataCollector::update_average_number_bitten(
                                                          Model::CONFIG->start_collect_data_day();
   const auto average_bites = number_of_times_bitten / static_cast<double>(time_living_from_start_collect_data_day);
 
-  average_number_biten_by_location_person_[location].push_back(average_bites);
+  average_number_biten_by_location_[location].add(average_bites);
 }
 
 void ModelDataCollector::calculate_percentage_bites_on_top_20() {
+  if (!metric_registry_.is_required(MetricRegistry::PERCENTAGE_BITES_ON_TOP_20)) {
+    return;
+  }
   auto pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
   for (auto loc = 0; loc < Model::CONFIG->number_of_locations(); loc++) {
     for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
@@ -561,27 +604,17 @@ void ModelDataCollector::calculate_percentage_bites_on_top_20() {
     }
   }
   for (auto location = 0; location < Model::CONFIG->number_of_locations(); location++) {
-    std::sort(
-        average_number_biten_by_location_person_[location].begin(),
-        average_number_biten_by_location_person_[location].end(), std::greater<>());
-    double total = 0;
-    double t20 = 0;
-    const auto size20 = static_cast<int>(std::round(
-        average_number_biten_by_location_person_[location].size() / 100.0 * 20
-    ));
-    // TODO: research about size_t and int comparison
-    for (auto i = 0; static_cast<size_t>(i) < average_number_biten_by_location_person_[location].size(); i++) {
-      total += average_number_biten_by_location_person_[location][i];
-
-      if (i <= size20) {
-        t20 += average_number_biten_by_location_person_[location][i];
-      }
-    }
-    percentage_bites_on_top_20_by_location_[location] = (total == 0) ? 0 : t20 / total;
+    auto& sketch = average_number_biten_by_location_[location];
+    const auto size20 = static_cast<long>(std::round(sketch.count() / 100.0 * 20));
+    const auto t20 = sketch.sum_of_largest(size20 + 1);
+    percentage_bites_on_top_20_by_location_[location] = (sketch.total() == 0) ? 0 : t20 / sketch.total();
   }
 }
 
 void ModelDataCollector::record_1_non_treated_case(const int& location, const int& age) {
+  if (!metric_registry_.is_required(MetricRegistry::BY_AGE_YEAR)) {
+    return;
+  }
   if (Model::SCHEDULER->current_time() >= Model::CONFIG->start_collect_data_day()) {
     if (age <= 79) {
       number_of_untreated_cases_by_location_age_year_[location][age] += 1;
@@ -609,21 +642,14 @@ void ModelDataCollector::end_of_time_step() {
   if (Model::SCHEDULER->current_time() >= Model::CONFIG->start_collect_data_day()) {
     double avg_tf = 0;
     for (auto location = 0; location < Model::CONFIG->number_of_locations(); location++) {
-      total_number_of_treatments_60_by_location_[location][Model::SCHEDULER->current_time() %
-                                                           Model::CONFIG->tf_window_size()] = today_number_of_treatments_by_location_[location];
-      total_RITF_60_by_location_[location][Model::SCHEDULER->current_time() %
-                                           Model::CONFIG->tf_window_size()] = today_RITF_by_location_[location];
-      total_TF_60_by_location_[location][Model::SCHEDULER->current_time() %
-                                         Model::CONFIG->tf_window_size()] = today_TF_by_location_[location];
-
-      auto t_treatment60 = 0;
-      auto t_ritf60 = 0;
-      auto t_tf60 = 0;
-      for (auto i = 0; i < Model::CONFIG->tf_window_size(); i++) {
-        t_treatment60 += total_number_of_treatments_60_by_location_[location][i];
-        t_ritf60 += total_RITF_60_by_location_[location][i];
-        t_tf60 += total_TF_60_by_location_[location][i];
-      }
+      total_number_of_treatments_60_by_location_[location].set(Model::SCHEDULER->current_time(),
+                                                               today_number_of_treatments_by_location_[location]);
+      total_RITF_60_by_location_[location].set(Model::SCHEDULER->current_time(), today_RITF_by_location_[location]);
+      total_TF_60_by_location_[location].set(Model::SCHEDULER->current_time(), today_TF_by_location_[location]);
+
+      const auto t_treatment60 = total_number_of_treatments_60_by_location_[location].sum();
+      const auto t_ritf60 = total_RITF_60_by_location_[location].sum();
+      const auto t_tf60 = total_TF_60_by_location_[location].sum();
       current_RITF_by_location_[location] = (t_treatment60 == 0) ? 0 : static_cast<double>(t_ritf60) /
                                                                        t_treatment60;
       current_TF_by_location_[location] = (t_treatment60 == 0) ? 0 : static_cast<double>(t_tf60) / t_treatment60;
@@ -641,17 +667,12 @@ void ModelDataCollector::end_of_time_step() {
       current_utl_duration_ += 1;
     }
     for (auto therapy_id = 0; static_cast<size_t>(therapy_id) < Model::CONFIG->therapy_db().size(); therapy_id++) {
-      total_number_of_treatments_60_by_therapy_[therapy_id][Model::SCHEDULER->current_time() %
-                                                            Model::CONFIG->tf_window_size()] = today_number_of_treatments_by_therapy_[therapy_id];
-      total_tf_60_by_therapy_[therapy_id][Model::SCHEDULER->current_time() %
-                                          Model::CONFIG->tf_window_size()] = today_tf_by_therapy_[therapy_id];
-
-      auto t_treatment60 = 0;
-      auto t_tf60 = 0;
-      for (auto i = 0; i < Model::CONFIG->tf_window_size(); i++) {
-        t_treatment60 += total_number_of_treatments_60_by_therapy_[therapy_id][i];
-        t_tf60 += total_tf_60_by_therapy_[therapy_id][i];
-      }
+      total_number_of_treatments_60_by_therapy_[therapy_id].set(Model::SCHEDULER->current_time(),
+                                                                today_number_of_treatments_by_therapy_[therapy_id]);
+      total_tf_60_by_therapy_[therapy_id].set(Model::SCHEDULER->current_time(), today_tf_by_therapy_[therapy_id]);
+
+      const auto t_treatment60 = total_number_of_treatments_60_by_therapy_[therapy_id].sum();
+      const auto t_tf60 = total_tf_60_by_therapy_[therapy_id].sum();
 
       current_tf_by_therapy_[therapy_id] = (t_treatment60 == 0) ? 0 : static_cast<double>(t_tf60) / t_treatment60;
       current_tf_by_therapy_[therapy_id] =
@@ -671,10 +692,12 @@ void ModelDataCollector::record_1_treatment(const int& location, const int& age,
 
     monthly_number_of_treatment_by_location_[location] += 1;
 
-    if (age <= 79) {
-      number_of_treatments_by_location_age_year_[location][age] += 1;
-    } else {
-      number_of_treatments_by_location_age_year_[location][79] += 1;
+    if (metric_registry_.is_required(MetricRegistry::BY_AGE_YEAR)) {
+      if (age <= 79) {
+        number_of_treatments_by_location_age_year_[location][age] += 1;
+      } else {
+        number_of_treatments_by_location_age_year_[location][79] += 1;
+      }
     }
   }
   if (Model::SCHEDULER->current_time() >= Model::CONFIG->start_of_comparison_period()) {
@@ -751,6 +774,9 @@ void ModelDataCollector::record_AMU_AFU(
     Person* person, Therapy* therapy,
     ClonalParasitePopulation* clinical_caused_parasite
 ) {
+  if (!metric_registry_.is_required(MetricRegistry::AMU_AFU)) {
+    return;
+  }
   if (Model::SCHEDULER->current_time() >= Model::CONFIG->start_of_comparison_period()) {
     auto sc_therapy = dynamic_cast<SCTherapy*>(therapy);
     if (sc_therapy != nullptr) {
@@ -10,6 +10,10 @@
 
 #include "Core/PropertyMacro.h"
 #include "Core/TypeDef.h"
+#include "GenotypeCensus.h"
+#include "TopShareSketch.h"
+#include "SlidingWindow.h"
+#include "MetricRegistry.h"
 
 class Model;
 
@@ -34,6 +38,10 @@ PROPERTY_REF(IntVector, popsize_by_location)
 
 PROPERTY_REF(IntVector, popsize_residence_by_location)
 
+// incremented every time popsize_residence_by_location is recomputed, so that its users (ex: the spatial model)
+// compare one integer instead of the whole vector
+READ_ONLY_PROPERTY(int, popsize_residence_by_location_version)
+
 PROPERTY_REF(IntVector2, popsize_by_location_age_class)
 
 PROPERTY_REF(IntVector2, popsize_by_location_age_class_by_5)
@@ -68,7 +76,7 @@ PROPERTY_REF(LongVector2, cumulative_clinical_episodes_by_location_age)
 
 PROPERTY_REF(LongVector2, cumulative_clinical_episodes_by_location_age_group)
 
-PROPERTY_REF(DoubleVector2, average_number_biten_by_location_person)
+PROPERTY_REF(std::vector<TopShareSketch>, average_number_biten_by_location)
 
 PROPERTY_REF(DoubleVector, percentage_bites_on_top_20_by_location)
 
@@ -87,11 +95,11 @@ PROPERTY_REF(IntVector, today_number_of_treatments_by_location)
 
 PROPERTY_REF(IntVector, today_RITF_by_location)
 
-PROPERTY_REF(IntVector2, total_number_of_treatments_60_by_location)
+PROPERTY_REF(IntSlidingWindowVector, total_number_of_treatments_60_by_location)
 
-PROPERTY_REF(IntVector2, total_RITF_60_by_location)
+PROPERTY_REF(IntSlidingWindowVector, total_RITF_60_by_location)
 
-PROPERTY_REF(IntVector2, total_TF_60_by_location)
+PROPERTY_REF(IntSlidingWindowVector, total_TF_60_by_location)
 
 PROPERTY_REF(DoubleVector, current_RITF_by_location)
 
@@ -132,15 +140,15 @@ PROPERTY_REF(DoubleVector, current_EIR_by_location)
 PROPERTY_REF(LongVector, last_update_total_number_of_bites_by_location)
 
 
-PROPERTY_REF(DoubleVector2, last_10_blood_slide_prevalence_by_location)
+PROPERTY_REF(DoubleSlidingWindowVector, last_10_blood_slide_prevalence_by_location)
 
 PROPERTY_REF(DoubleVector2, last_10_blood_slide_prevalence_by_location_age_class)
 
-PROPERTY_REF(DoubleVector2, last_10_fraction_positive_that_are_clinical_by_location)
+PROPERTY_REF(DoubleSlidingWindowVector, last_10_fraction_positive_that_are_clinical_by_location)
 
-PROPERTY_REF(DoubleVector3, last_10_fraction_positive_that_are_clinical_by_location_age_class)
+PROPERTY_REF(DoubleSlidingWindowVector2, last_10_fraction_positive_that_are_clinical_by_location_age_class)
 
-PROPERTY_REF(DoubleVector3, last_10_fraction_positive_that_are_clinical_by_location_age_class_by_5)
+PROPERTY_REF(DoubleSlidingWindowVector2, last_10_fraction_positive_that_are_clinical_by_location_age_class_by_5)
 
 PROPERTY_REF(IntVector, total_parasite_population_by_location)
 
@@ -198,9 +206,9 @@ PROPERTY_REF(IntVector, today_number_of_treatments_by_therapy)
 
 PROPERTY_REF(DoubleVector, current_tf_by_therapy)
 
-PROPERTY_REF(IntVector2, total_number_of_treatments_60_by_therapy)
+PROPERTY_REF(IntSlidingWindowVector, total_number_of_treatments_60_by_therapy)
 
-PROPERTY_REF(IntVector2, total_tf_60_by_therapy)
+PROPERTY_REF(IntSlidingWindowVector, total_tf_60_by_therapy)
 
 PROPERTY_REF(double, mean_moi)
 
@@ -208,6 +216,10 @@ PROPERTY_REF(LongVector, number_of_mutation_events_by_year)
 
 PROPERTY_REF(long, current_number_of_mutation_events_in_this_year)
 
+READ_ONLY_PROPERTY_REF(GenotypeCensus, genotype_census)
+
+READ_ONLY_PROPERTY_REF(MetricRegistry, metric_registry)
+
 
   static const int number_of_reported_MOI = 8;
 
@@ -0,0 +1,74 @@
+//
+// SlidingWindow.h
+//
+
+#ifndef SLIDINGWINDOW_H
+#define SLIDINGWINDOW_H
+
+#include <vector>
+#include <type_traits>
+
+/**
+ * SlidingWindow is a fixed size ring buffer indexed by an ever increasing time step (slot = time % size) that keeps
+ * the sum of its slots up to date, so that windowed aggregates such as the treatment failure rate over the last
+ * tf_window_size days cost O(1) per update instead of re-summing the whole window every day.
+ *
+ * For floating point values the running sum is recomputed every time the ring wraps around, which keeps rounding
+ * error bounded to one window while the amortized cost stays O(1).
+ */
+template<typename T>
+class SlidingWindow {
+ public:
+  explicit SlidingWindow(const int &size = 0, const T &initial_value = T()) : values_(size, initial_value),
+                                                                            sum_(initial_value * size) {}
+
+  /// replaces the value stored at slot time % size() and updates the running sum
+  void set(const long &time, const T &value) {
+    const auto slot = static_cast<std::size_t>(time % values_.size());
+    sum_ += value - values_[slot];
+    values_[slot] = value;
+
+    if (std::is_floating_point<T>::value && slot == 0) {
+      recompute_sum();
+    }
+  }
+
+  /// value stored at slot time % size()
+  const T &get(const long &time) const {
+    return values_[static_cast<std::size_t>(time % values_.size())];
+  }
+
+  const T &operator[](const std::size_t &slot) const {
+    return values_[slot];
+  }
+
+  T sum() const {
+    return sum_;
+  }
+
+  int size() const {
+    return static_cast<int>(values_.size());
+  }
+
+  const std::vector<T> &values() const {
+    return values_;
+  }
+
+ private:
+  void recompute_sum() {
+    sum_ = T();
+    for (const auto &value : values_) {
+      sum_ += value;
+    }
+  }
+
+  std::vector<T> values_;
+
+  T sum_;
+};
+
+typedef std::vector<SlidingWindow<int>> IntSlidingWindowVector;
+typedef std::vector<SlidingWindow<double>> DoubleSlidingWindowVector;
+typedef std::vector<DoubleSlidingWindowVector> DoubleSlidingWindowVector2;
+
+#endif // SLIDINGWINDOW_H
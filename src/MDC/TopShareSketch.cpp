@@ -0,0 +1,54 @@
+//
+// TopShareSketch.cpp
+//
+
+#include <cmath>
+#include <algorithm>
+#include "TopShareSketch.h"
+
+TopShareSketch::TopShareSketch(const double &relative_error) : relative_error_(relative_error), count_(0), total_(0),
+                                                               log_gamma_(std::log1p(relative_error)),
+                                                               zero_count_(0) {}
+
+void TopShareSketch::add(const double &value) {
+  count_++;
+  if (value <= 0) {
+    zero_count_++;
+    return;
+  }
+  total_ += value;
+
+  const auto index = static_cast<int>(std::ceil(std::log(value) / log_gamma_));
+  auto &bucket = buckets_[index];
+  bucket.count++;
+  bucket.sum += value;
+}
+
+void TopShareSketch::clear() {
+  count_ = 0;
+  total_ = 0;
+  zero_count_ = 0;
+  buckets_.clear();
+}
+
+double TopShareSketch::sum_of_largest(const long &number_of_values) const {
+  auto remaining = std::min(number_of_values, count_);
+  auto result = 0.0;
+
+  for (auto it = buckets_.rbegin(); it != buckets_.rend() && remaining > 0; ++it) {
+    if (it->second.count <= remaining) {
+      result += it->second.sum;
+      remaining -= it->second.count;
+    } else {
+      // every value in this bucket lies within a factor gamma of the bucket mean
+      result += remaining * (it->second.sum / it->second.count);
+      remaining = 0;
+    }
+  }
+  // the rest are zeros
+  return result;
+}
+
+std::size_t TopShareSketch::number_of_buckets() const {
+  return buckets_.size();
+}
@@ -0,0 +1,55 @@
+//
+// TopShareSketch.h
+//
+
+#ifndef TOPSHARESKETCH_H
+#define TOPSHARESKETCH_H
+
+#include <map>
+#include "Core/PropertyMacro.h"
+
+/**
+ * TopShareSketch is a streaming summary of non-negative values that answers "how much of the total is held by the
+ * k largest values" without storing the values themselves.
+ *
+ * Values are kept in logarithmic buckets (gamma^(i-1), gamma^i] with gamma = 1 + relative_error, each bucket
+ * holding an exact count and an exact sum. Only the bucket that straddles the k-th largest value has to be
+ * interpolated, so sum_of_largest() is within relative_error of the exact answer, while the memory used is bounded
+ * by log(max/min) / log(gamma) buckets regardless of the number of values added.
+ */
+class TopShareSketch {
+ READ_ONLY_PROPERTY_REF(double, relative_error)
+
+ READ_ONLY_PROPERTY_REF(long, count)
+
+ READ_ONLY_PROPERTY_REF(double, total)
+
+ public:
+  explicit TopShareSketch(const double &relative_error = 0.01);
+
+  virtual ~TopShareSketch() = default;
+
+  void add(const double &value);
+
+  void clear();
+
+  /// sum of the number_of_values largest values added so far
+  double sum_of_largest(const long &number_of_values) const;
+
+  std::size_t number_of_buckets() const;
+
+ private:
+  struct Bucket {
+    long count;
+    double sum;
+  };
+
+  double log_gamma_;
+
+  long zero_count_;
+
+  // bucket index i holds values in (gamma^(i-1), gamma^i]
+  std::map<int, Bucket> buckets_;
+};
+
+#endif // TOPSHARESKETCH_H
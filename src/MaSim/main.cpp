@@ -13,6 +13,8 @@
 // #include "error_handler.hxx"
 #include "Helpers/OSHelpers.h"
 #include "Model.h"
+#include "Core/Config/Config.h"
+#include "Reporters/ModeComparison.h"
 
 // Set this flag to disable Linux / Unix specific code, this should be provided
 // via CMake automatically
@@ -28,6 +30,8 @@ namespace {
 // Settings read from the CLI
 int job_number = 0;
 std::string path("");
+std::string compare_overrides("");
+int number_of_replicates = 10;
 
 INITIALIZE_EASYLOGGINGPP
 
@@ -108,6 +112,13 @@ int main(const int argc, char **argv) {
     config_logger();
     START_EASYLOGGINGPP(argc, argv);
 
+    if (!compare_overrides.empty()) {
+      const auto config_file = m->config_filename();
+      delete m;
+      ModeComparison comparison(config_file, compare_overrides, number_of_replicates);
+      exit(comparison.run() ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
     // Run the model
     m->initialize();
     m->run();
@@ -126,6 +137,10 @@ void handle_cli(Model *model, int argc, char **argv) {
   args::ValueFlag<int> cluster_job_number(commands, "int", "Cluster job number. \nEx: MaSim -j 1", {'j'});
   args::ValueFlag<std::string> reporter(commands, "string", "Reporter Type. \nEx: MaSim -r mmc", {'r'});
   args::ValueFlag<std::string> input_path(commands, "string", "Path for output files, default is current directory. \nEx: MaSim -p out", {'o'});
+  args::ValueFlag<std::string> compile_config(commands, "string", "Compile the derived tables of a config file into a binary cache and exit, -o gives the cache file. \nEx: MaSim --compile-config input.yml -o input.masimcfg", {"compile-config"});
+  args::ValueFlag<std::string> config_cache(commands, "string", "Binary config cache created by --compile-config for the same config file. \nEx: MaSim -i input.yml --config-cache input.masimcfg", {"config-cache"});
+  args::ValueFlag<std::string> compare(commands, "string", "Compare the statistics of seeded replicates of the config file with and without the given config overrides and exit, the exit status is 0 when they agree. \nEx: MaSim -i input.yml --compare \"{using_hybrid_compartmental_mode: true}\"", {"compare"});
+  args::ValueFlag<int> replicates(commands, "int", "Number of replicates of each model for --compare, default is 10. \nEx: MaSim -i input.yml --compare \"{using_hybrid_compartmental_mode: true}\" --replicates 20", {"replicates"});
   
   // Allow the --v=[int] flag to be processed by START_EASYLOGGINGPP
   args::Group arguments(parser, "verbosity", args::Group::Validators::DontCare, args::Options::Global);
@@ -147,6 +162,20 @@ void handle_cli(Model *model, int argc, char **argv) {
     exit(EXIT_FAILURE);
   }
 
+  if (compile_config) {
+    const auto config_file = args::get(compile_config);
+    if (!OsHelpers::file_exists(config_file)) {
+      LOG(ERROR) << fmt::format("File {0} does not exists. Rerun with -h or --help for help.", config_file);
+      exit(EXIT_FAILURE);
+    }
+    const auto cache_file = input_path
+                            ? args::get(input_path)
+                            : config_file.substr(0, config_file.find_last_of('.')) + ".masimcfg";
+    model->config()->read_from_file(config_file);
+    model->config()->write_cache(config_file, cache_file);
+    exit(EXIT_SUCCESS);
+  }
+
   // Check for the existence of the input file, exit if it doesn't exist.
   const auto input = input_file ? args::get(input_file) : "input.yml";
   if (!OsHelpers::file_exists(input)) {    
@@ -154,6 +183,9 @@ void handle_cli(Model *model, int argc, char **argv) {
     exit(EXIT_FAILURE);
   }
   model->set_config_filename(input);
+  if (config_cache) {
+    model->set_config_cache_filename(args::get(config_cache));
+  }
   
   // Set the remaining values if given
   path = input_path ? args::get(input_path) : path;
@@ -161,4 +193,10 @@ void handle_cli(Model *model, int argc, char **argv) {
   model->set_cluster_job_number(job_number);
   const auto reporter_type = reporter ? args::get(reporter) : "";
   model->set_reporter_type(reporter_type);
+  compare_overrides = compare ? args::get(compare) : compare_overrides;
+  number_of_replicates = replicates ? args::get(replicates) : number_of_replicates;
+  if (number_of_replicates < 2) {
+    LOG(ERROR) << "At least 2 replicates are needed to compare the models.";
+    exit(EXIT_FAILURE);
+  }
 }
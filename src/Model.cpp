@@ -11,14 +11,13 @@
 #include "Population/Person.h"
 #include "Core/Random.h"
 #include "MDC/ModelDataCollector.h"
-#include "Events/BirthdayEvent.h"
 #include "Events/ProgressToClinicalEvent.h"
 #include "Events/EndClinicalDueToDrugResistanceEvent.h"
 #include "Events/TestTreatmentFailureEvent.h"
 #include "Events/UpdateWhenDrugIsPresentEvent.h"
 #include "Events/EndClinicalByNoTreatmentEvent.h"
 #include "Events/EndClinicalEvent.h"
-#include "Therapies/Drug.h"
+#include "Population/DrugsInBlood.h"
 #include "Population/ImmuneSystem.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
 #include "Events/MatureGametocyteEvent.h"
@@ -27,6 +26,8 @@
 #include "Reporters/Reporter.h"
 #include "Events/CirculateToTargetLocationNextDayEvent.h"
 #include "Events/ReturnToResidenceEvent.h"
+#include "Events/InfectionEvent.h"
+#include "Events/Population/BirthEvent.h"
 #include "Population/ClonalParasitePopulation.h"
 #include "Events/SwitchImmuneComponentEvent.h"
 #include "Events/Population/ImportationPeriodicallyEvent.h"
@@ -36,7 +37,6 @@
 #include "Strategies/IStrategy.h"
 #include "Malaria/SteadyTCM.h"
 #include "Constants.h"
-#include "Helpers/TimeHelpers.h"
 
 Model* Model::MODEL = nullptr;
 Config* Model::CONFIG = nullptr;
@@ -74,6 +74,8 @@ Model::Model(const int& object_pool_size) {
 
   initial_seed_number_ = 0;
   config_filename_ = "config.yml";
+  config_cache_filename_ = "";
+  config_overrides_ = "";
   tme_filename_ = "tme.txt";
   override_parameter_filename_ = "";
   override_parameter_line_number_ = -1;
@@ -136,7 +138,7 @@ void Model::initialize() {
 
   LOG(INFO) << fmt::format("Read input file: {}", config_filename_);
   //Read input file
-  config_->read_from_file(config_filename_);
+  config_->read_from_file(config_filename_, config_cache_filename_, config_overrides_);
 
   //add reporter here
   if (reporter_type_.empty()) {
@@ -192,7 +194,6 @@ void Model::initialize() {
 }
 
 void Model::initialize_object_pool(const int& size) {
-  BirthdayEvent::InitializeObjectPool(size);
   ProgressToClinicalEvent::InitializeObjectPool(size);
   EndClinicalDueToDrugResistanceEvent::InitializeObjectPool(size);
   UpdateWhenDrugIsPresentEvent::InitializeObjectPool(size);
@@ -203,15 +204,16 @@ void Model::initialize_object_pool(const int& size) {
   UpdateEveryKDaysEvent::InitializeObjectPool(size);
   CirculateToTargetLocationNextDayEvent::InitializeObjectPool(size);
   ReturnToResidenceEvent::InitializeObjectPool(size);
+  InfectionEvent::InitializeObjectPool(size);
   SwitchImmuneComponentEvent::InitializeObjectPool(size);
   ImportationPeriodicallyEvent::InitializeObjectPool(size);
   ImportationEvent::InitializeObjectPool(size);
+  BirthEvent::InitializeObjectPool(size);
   TestTreatmentFailureEvent::InitializeObjectPool(size);
 
   ClonalParasitePopulation::InitializeObjectPool(size);
   SingleHostClonalParasitePopulations::InitializeObjectPool();
 
-  Drug::InitializeObjectPool(size);
   DrugsInBlood::InitializeObjectPool(size);
 
   //    InfantImmuneComponent::InitializeObjectPool(size);
@@ -231,15 +233,16 @@ void Model::release_object_pool() {
   //    NonInfantImmuneComponent::ReleaseObjectPool();
 
   DrugsInBlood::ReleaseObjectPool();
-  Drug::ReleaseObjectPool();
 
   SingleHostClonalParasitePopulations::ReleaseObjectPool();
   ClonalParasitePopulation::ReleaseObjectPool();
 
   TestTreatmentFailureEvent::ReleaseObjectPool();
+  BirthEvent::ReleaseObjectPool();
   ImportationEvent::ReleaseObjectPool();
   ImportationPeriodicallyEvent::ReleaseObjectPool();
   SwitchImmuneComponentEvent::ReleaseObjectPool();
+  InfectionEvent::ReleaseObjectPool();
   ReturnToResidenceEvent::ReleaseObjectPool();
   CirculateToTargetLocationNextDayEvent::ReleaseObjectPool();
   UpdateEveryKDaysEvent::ReleaseObjectPool();
@@ -250,7 +253,6 @@ void Model::release_object_pool() {
   UpdateWhenDrugIsPresentEvent::ReleaseObjectPool();
   EndClinicalDueToDrugResistanceEvent::ReleaseObjectPool();
   ProgressToClinicalEvent::ReleaseObjectPool();
-  BirthdayEvent::ReleaseObjectPool();
 }
 
 void Model::run() {
@@ -279,6 +281,8 @@ void Model::after_run() {
 }
 
 void Model::begin_time_step() {
+  population_->perform_age_class_transitions(scheduler_->current_time());
+
   //reset daily variables
   data_collector_->begin_time_step();
   report_begin_of_time_step();
@@ -286,20 +290,28 @@ void Model::begin_time_step() {
 
 void Model::perform_population_events_daily() const {
   // TODO: turn on and off time for art mutation in the input file
-  population_->perform_infection_event();
-  population_->perform_birth_event();
-  population_->perform_circulation_event();
+  if (scheduler_->infection_event_step() > 0) {
+    population_->perform_infection_event(scheduler_->infection_event_step());
+  }
+
+  const auto number_of_days = scheduler_->population_event_step();
+  if (number_of_days==0) return;
+
+  population_->perform_birth_event(number_of_days);
+  population_->perform_circulation_event(number_of_days);
 }
 
 void Model::daily_update(const int& current_time) {
   //for safety remove all dead by calling perform_death_event
-  population_->perform_death_event();
+  population_->perform_death_event(scheduler_->population_event_step());
 
   //update / calculate daily UTL
   data_collector_->end_of_time_step();
 
-  //update force of infection
-  population_->update_force_of_infection(current_time);
+  //update force of infection, it stays 0 in a quiescent period
+  if (!scheduler_->is_fast_forwarding()) {
+    population_->update_force_of_infection(current_time);
+  }
 
   //check to switch strategy
   treatment_strategy_->update_end_of_time_step();
@@ -378,24 +390,5 @@ void Model::add_reporter(Reporter* reporter) {
 }
 
 double Model::get_seasonal_factor(const date::sys_days& today, const int& location) const {
-  if (!Model::CONFIG->seasonal_info().enable) {
-    return 1;
-  }
-  const auto day_of_year = TimeHelpers::day_of_year(today);
-  const auto is_rainy_period = Model::CONFIG->seasonal_info().phi[location] < Constants::DAYS_IN_YEAR() / 2.0
-                               ? day_of_year >= Model::CONFIG->seasonal_info().phi[location]
-                                 && day_of_year <=
-                                    Model::CONFIG->seasonal_info().phi[location] + Constants::DAYS_IN_YEAR() / 2.0
-                               : day_of_year >= Model::CONFIG->seasonal_info().phi[location]
-                                 || day_of_year <=
-                                    Model::CONFIG->seasonal_info().phi[location] - Constants::DAYS_IN_YEAR() / 2.0;
-
-  return (is_rainy_period)
-         ? (Model::CONFIG->seasonal_info().A[location] - Model::CONFIG->seasonal_info().min_value[location]) *
-           sin(
-               Model::CONFIG->seasonal_info().B[location] * day_of_year +
-               Model::CONFIG->seasonal_info().C[location]
-           ) +
-           Model::CONFIG->seasonal_info().min_value[location]
-         : Model::CONFIG->seasonal_info().min_value[location];
+  return Model::CONFIG->seasonal_info().get_factor(location, scheduler_->calendar().day_of(today).day_of_year);
 }
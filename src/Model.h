@@ -56,6 +56,11 @@ class Model {
 
  PROPERTY_REF(std::string, config_filename)
 
+ PROPERTY_REF(std::string, config_cache_filename)
+
+ // YAML map of config items replacing those of the config file, see Config::read_from_file
+ PROPERTY_REF(std::string, config_overrides)
+
  PROPERTY_REF(int, cluster_job_number)
 
  PROPERTY_REF(std::string, tme_filename)
@@ -12,7 +12,19 @@
 #include "Core/Random.h"
 #include "Therapies/SCTherapy.h"
 
-Genotype::Genotype(const int &id, const GenotypeInfo &genotype_info, const IntVector &weight) : genotype_id_(id) {
+const int Genotype::MAX_NUMBER_OF_ALLELES;
+
+AlleleBits Genotype::allele_bit(const GenotypeInfo &genotype_info, const int &locus, const int &allele) {
+  auto position = allele;
+  for (auto i = 0; i < locus; i++) {
+    position += static_cast<int>(genotype_info.loci_vector[i].alleles.size());
+  }
+  return AlleleBits{1} << position;
+}
+
+Genotype::Genotype(const int &id, const GenotypeInfo &genotype_info, const IntVector &weight) : genotype_id_(id),
+                                                                                               allele_bits_(0),
+                                                                                               resistant_drugs_(0) {
 
   gene_expression_.clear();
   //
@@ -37,31 +49,28 @@ Genotype::Genotype(const int &id, const GenotypeInfo &genotype_info, const IntVe
     number_of_resistance_position_ += genotype_info.loci_vector[i].alleles[gene_expression_[i]].mutation_level;
   }
 
+  for (auto i = 0; i < genotype_info.loci_vector.size(); i++) {
+    allele_bits_ |= allele_bit(genotype_info, i, gene_expression_[i]);
+  }
+
 }
 
 Genotype::~Genotype() = default;
 
 bool Genotype::resist_to(DrugType* dt) {
-  for (auto i = 0; i < dt->affecting_loci().size(); i++) {
-    for (auto j = 0; j < dt->selecting_alleles()[i].size(); j++) {
-      if (gene_expression_[dt->affecting_loci()[i]]==dt->selecting_alleles()[i][j]) {
-        return true;
-      }
-    }
-  }
-  return false;
+  return (allele_bits_ & dt->resistant_allele_bits()) != 0;
 }
 
 bool Genotype::resist_to(Therapy* therapy) {
-  auto* sc_therapy = dynamic_cast<SCTherapy*> (therapy);
-  if (sc_therapy!=nullptr) {
-    for (auto drug_id : sc_therapy->drug_ids) {
-      if (resist_to(Model::CONFIG->drug_db()->at(drug_id))) {
-        return true;
-      }
-    }
+  return (allele_bits_ & therapy->resistant_allele_bits) != 0;
+}
+
+bool Genotype::resist_to(const int &drug_id) const {
+  if (drug_id >= static_cast<int>(8*sizeof(DrugBits))) {
+    // beyond the bits of resistant_drugs
+    return (allele_bits_ & Model::CONFIG->drug_db()->at(drug_id)->resistant_allele_bits()) != 0;
   }
-  return false;
+  return ((resistant_drugs_ >> drug_id) & 1) != 0;
 }
 
 Genotype* Genotype::combine_mutation_to(const int &locus, const int &value) {
@@ -69,14 +78,8 @@ Genotype* Genotype::combine_mutation_to(const int &locus, const int &value) {
     return this;
   }
 
-  auto id = 0;
-  for (auto i = 0; i < gene_expression_.size(); i++) {
-    if (i==locus) {
-      id += Model::CONFIG->genotype_db()->weight()[i]*value;
-    } else {
-      id += Model::CONFIG->genotype_db()->weight()[i]*gene_expression_[i];
-    }
-  }
+  // only the digit of locus changes in the mixed radix id
+  const auto id = genotype_id_ + Model::CONFIG->genotype_db()->weight()[locus]*(value - gene_expression_[locus]);
   return Model::CONFIG->genotype_db()->at(id);
 }
 
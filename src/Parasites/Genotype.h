@@ -28,9 +28,20 @@ class Genotype {
 
  PROPERTY_REF(int, number_of_resistance_position)
 
+  // packed gene expression: the bit of the allele of every locus
+ PROPERTY_REF(AlleleBits, allele_bits)
+
+  // bit d is set when the genotype resists drug type d (d < 64), see GenotypeDatabase::initialize_resistance
+ PROPERTY_REF(DrugBits, resistant_drugs)
+
  POINTER_PROPERTY(DrugDatabase, drug_db)
 
  public:
+  static const int MAX_NUMBER_OF_ALLELES = 64;
+
+  /// bit of an allele in allele_bits, alleles of all loci are numbered consecutively
+  static AlleleBits allele_bit(const GenotypeInfo &genotype_info, const int &locus, const int &allele);
+
   explicit Genotype(const int &id, const GenotypeInfo &genotype_info, const IntVector &weight);
 
   virtual ~Genotype();
@@ -43,6 +54,8 @@ class Genotype {
 
   bool resist_to(Therapy *therapy);
 
+  bool resist_to(const int &drug_id) const;
+
   Genotype *combine_mutation_to(const int &locus, const int &value);
 
   int select_mutation_allele(const int &mutation_locus);
@@ -7,6 +7,9 @@
 
 #include "GenotypeDatabase.h"
 #include "Genotype.h"
+#include "Therapies/DrugDatabase.h"
+#include "Therapies/DrugType.h"
+#include "Core/Random.h"
 #include "Core/Config/Config.h"
 #include "Helpers/NumberHelpers.h"
 
@@ -24,6 +27,53 @@ void GenotypeDatabase::add(Genotype *genotype) {
     delete (*this)[genotype->genotype_id()];
   }
   (*this)[genotype->genotype_id()] = genotype;
+  if (genotypes_.size() <= genotype->genotype_id()) {
+    genotypes_.resize(genotype->genotype_id() + 1, nullptr);
+  }
+  genotypes_[genotype->genotype_id()] = genotype;
+}
+
+void GenotypeDatabase::initialize_mutation_table(const GenotypeInfo &genotype_info) {
+  number_of_loci_ = static_cast<int>(genotype_info.loci_vector.size());
+  mutation_offsets_.assign(1, 0);
+  mutation_targets_.clear();
+  for (auto *genotype : genotypes_) {
+    for (auto locus = 0; locus < number_of_loci_; locus++) {
+      const auto allele = genotype->gene_expression()[locus];
+      for (auto value : genotype_info.loci_vector[locus].alleles[allele].mutation_values) {
+        mutation_targets_.push_back(genotype->genotype_id() + weight_[locus]*(value - allele));
+      }
+      mutation_offsets_.push_back(static_cast<int>(mutation_targets_.size()));
+    }
+  }
+}
+
+int GenotypeDatabase::number_of_mutation_targets(const int &genotype_id, const int &locus) const {
+  const auto i = genotype_id * number_of_loci_ + locus;
+  return mutation_offsets_[i + 1] - mutation_offsets_[i];
+}
+
+int GenotypeDatabase::mutation_target(const int &genotype_id, const int &locus, const int &index) const {
+  return mutation_targets_[mutation_offsets_[genotype_id * number_of_loci_ + locus] + index];
+}
+
+Genotype *GenotypeDatabase::mutate(Genotype *genotype, const int &locus, Random *random) const {
+  const auto index = random->random_uniform_int(0, number_of_mutation_targets(genotype->genotype_id(), locus));
+  return genotypes_[mutation_target(genotype->genotype_id(), locus, static_cast<int>(index))];
+}
+
+void GenotypeDatabase::initialize_resistance(DrugDatabase *drug_db) {
+  for (auto &i : *this) {
+    auto *genotype = i.second;
+    genotype->resistant_drugs() = 0;
+    for (auto &drug : *drug_db) {
+      // the resistance to the drug types beyond the bits of DrugBits is evaluated by Genotype::resist_to
+      if (drug.second->id() < static_cast<int>(8*sizeof(DrugBits))
+          && (genotype->allele_bits() & drug.second->resistant_allele_bits()) != 0) {
+        genotype->resistant_drugs() |= DrugBits{1} << drug.second->id();
+      }
+    }
+  }
 }
 
 void GenotypeDatabase::initialize_matting_matrix() {
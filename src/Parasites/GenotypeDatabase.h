@@ -15,6 +15,10 @@
 
 class Genotype;
 
+class DrugDatabase;
+
+class Random;
+
 typedef std::map<ul, Genotype*> GenotypePtrMap;
 typedef std::vector<std::vector<std::vector<double>>> MatingMatrix;
 
@@ -42,7 +46,31 @@ class GenotypeDatabase : public GenotypePtrMap {
 
   double get_offspring_density(const int &m, const int &f, const int &p);
 
+  /// sets the resistant drugs of every genotype in one pass over the database
+  void initialize_resistance(DrugDatabase *drug_db);
+
+  /// builds the mutation targets of every (genotype, locus), once all the genotypes are added
+  void initialize_mutation_table(const GenotypeInfo &genotype_info);
+
+  int number_of_mutation_targets(const int &genotype_id, const int &locus) const;
+
+  /// id of the genotype reached by the index-th mutation value of the allele of genotype_id at locus
+  int mutation_target(const int &genotype_id, const int &locus, const int &index) const;
+
+  /// genotype reached when genotype mutates at locus, with one uniform draw among the mutation values of its allele
+  Genotype *mutate(Genotype *genotype, const int &locus, Random *random) const;
+
  private:
+  // genotypes indexed by id
+  std::vector<Genotype *> genotypes_;
+
+  int number_of_loci_{0};
+
+  // targets of (genotype, locus) are mutation_targets_[mutation_offsets_[i]..mutation_offsets_[i + 1]) with
+  // i = genotype_id * number_of_loci_ + locus
+  IntVector mutation_offsets_;
+
+  IntVector mutation_targets_;
 
 };
 
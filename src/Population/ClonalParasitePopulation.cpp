@@ -60,6 +60,11 @@ double ClonalParasitePopulation::last_update_log10_parasite_density() const {
 }
 
 void ClonalParasitePopulation::set_last_update_log10_parasite_density(const double &value) {
+  if (parasite_population_==nullptr) {
+    // not in a host yet, nothing to account for
+    last_update_log10_parasite_density_ = value;
+    return;
+  }
   if (NumberHelpers::is_enot_qual(last_update_log10_parasite_density_, value)) {
     parasite_population_->remove_all_infection_force();
     last_update_log10_parasite_density_ = value;
@@ -72,6 +77,10 @@ double ClonalParasitePopulation::gametocyte_level() const {
 }
 
 void ClonalParasitePopulation::set_gametocyte_level(const double &value) {
+  if (parasite_population_==nullptr) {
+    gametocyte_level_ = value;
+    return;
+  }
   if (NumberHelpers::is_enot_qual(gametocyte_level_, value)) {
     parasite_population_->remove_all_infection_force();
     gametocyte_level_ = value;
@@ -85,9 +94,15 @@ Genotype *ClonalParasitePopulation::genotype() const {
 }
 
 void ClonalParasitePopulation::set_genotype(Genotype *value) {
+  if (parasite_population_==nullptr) {
+    genotype_ = value;
+    return;
+  }
   if (genotype_!=value) {
     parasite_population_->remove_all_infection_force();
+    parasite_population_->remove_from_genotype_census();
     genotype_ = value;
+    parasite_population_->add_to_genotype_census();
     parasite_population_->add_all_infection_force();
   }
 }
@@ -101,7 +116,7 @@ bool ClonalParasitePopulation::resist_to(DrugType *dt) const {
 }
 
 bool ClonalParasitePopulation::resist_to(const int &drug_id) const {
-  return genotype_->resist_to(Model::CONFIG->drug_db()->at(drug_id));
+  return genotype_->resist_to(drug_id);
 }
 
 void ClonalParasitePopulation::update() {
@@ -109,19 +124,23 @@ void ClonalParasitePopulation::update() {
 }
 
 void ClonalParasitePopulation::perform_drug_action(const double &percent_parasite_remove) {
+//    std::cout << Model::SCHEDULER->current_time() << "\t" <<parasite_population()->person() << "\t"  << percent_parasite_remove << "\t"<<last_update_log10_parasite_density_ << std::endl;
+  set_last_update_log10_parasite_density(get_parasite_density_after_drug_action(
+      Model::CONFIG->parasite_density_level(), last_update_log10_parasite_density_, percent_parasite_remove));
+}
 
-
-  double newSize = last_update_log10_parasite_density_;
+double ClonalParasitePopulation::get_parasite_density_after_drug_action(const ParasiteDensityLevel &pdl,
+                                                                        const double &log10_parasite_density,
+                                                                        const double &percent_parasite_remove) {
+  double newSize = log10_parasite_density;
   if (percent_parasite_remove > 1) {
-    newSize = Model::CONFIG->parasite_density_level().log_parasite_density_cured;
+    newSize = pdl.log_parasite_density_cured;
   } else {
     newSize += log10(1 - percent_parasite_remove);
   }
 
-  if (newSize < Model::CONFIG->parasite_density_level().log_parasite_density_cured) {
-    newSize = Model::CONFIG->parasite_density_level().log_parasite_density_cured;
+  if (newSize < pdl.log_parasite_density_cured) {
+    newSize = pdl.log_parasite_density_cured;
   }
-
-//    std::cout << Model::SCHEDULER->current_time() << "\t" <<parasite_population()->person() << "\t"  << percent_parasite_remove << "\t"<<last_update_log10_parasite_density_ << "\t" <<newSize << std::endl;
-  set_last_update_log10_parasite_density(newSize);
+  return newSize;
 }
@@ -61,6 +61,11 @@ class ClonalParasitePopulation : public IndexHandler {
 
   void perform_drug_action(const double &percent_parasite_remove);
 
+  /// log10 parasite density after the drugs remove percent_parasite_remove of the parasites, at least the cured level
+  static double get_parasite_density_after_drug_action(const ParasiteDensityLevel &pdl,
+                                                       const double &log10_parasite_density,
+                                                       const double &percent_parasite_remove);
+
 };
 
 #endif    /* CLONALPARASITEPOPULATION_H */
@@ -6,58 +6,76 @@
  */
 
 #include "DrugsInBlood.h"
+#include <algorithm>
 #include "Therapies/Drug.h"
 #include "Events/Event.h"
 #include "Therapies/DrugType.h"
 #include "Person.h"
-#include "Helpers/ObjectHelpers.h"
 #include "Core/TypeDef.h"
-
-#ifndef DRUG_CUT_OFF_VALUE
-#define DRUG_CUT_OFF_VALUE 0.1
-#endif
+#include "easylogging++.h"
 
 OBJECTPOOL_IMPL(DrugsInBlood)
 
-DrugsInBlood::DrugsInBlood(Person *person) : person_(person), drugs_(nullptr) {}
+const int DrugsInBlood::CAPACITY;
+
+DrugsInBlood::DrugsInBlood(Person *person) : person_(person), drugs_(inline_drugs_), size_(0), capacity_(CAPACITY) {}
 
 void DrugsInBlood::init() {
-  drugs_ = new DrugPtrMap();
+  size_ = 0;
 }
 
-DrugsInBlood::~DrugsInBlood() {
-  if (drugs_!=nullptr) {
-    clear();
-    ObjectHelpers::delete_pointer<DrugPtrMap>(drugs_);
+DrugsInBlood::~DrugsInBlood() = default;
+
+int DrugsInBlood::lower_bound(const int &drug_type_id) const {
+  auto index = 0;
+  while (index < size_ && drugs_[index].drug_type_id() < drug_type_id) {
+    index++;
   }
+  return index;
 }
 
-Drug *DrugsInBlood::add_drug(Drug *drug) {
-  int typeID = drug->drug_type()->id();
-  if (!is_drug_in_blood(typeID)) {
-    drug->set_person_drugs(this);
-    drugs_->insert(std::pair<int, Drug *>(typeID, drug));
+Drug *DrugsInBlood::add_drug(Drug drug) {
+  const auto type_id = drug.drug_type_id();
+  const auto index = lower_bound(type_id);
+  if (index < size_ && drugs_[index].drug_type_id() == type_id) {
+    //already have it
+    auto &current = drugs_[index];
+    current.set_dosing_days(drug.dosing_days());
+    current.set_last_update_value(drug.last_update_value());
+    current.set_last_update_time(drug.last_update_time());
+    current.set_start_time(drug.start_time());
+    current.set_end_time(drug.end_time());
+    return &current;
+  }
 
+  if (size_ == capacity_) {
+    grow();
+  }
 
-    // TODO::review
-    // if (drug->drug_type()->is_artemisinin()) {
-    //   person_->all_clonal_parasite_populations()->active_astermisinin_on_gametocyte(drug->drug_type());
-    // }
-  } else {
-    //already have it
-    drugs_->at(typeID)->set_dosing_days(drug->dosing_days());
-    drugs_->at(typeID)->set_last_update_value(drug->last_update_value());
-    drugs_->at(typeID)->set_last_update_time(drug->last_update_time());
-    drugs_->at(typeID)->set_start_time(drug->start_time());
-    drugs_->at(typeID)->set_end_time(drug->end_time());
-
-    //        person->cancelEvent(Events::ClearDrugFromBlood, typeID);
-    //release current drug to pool
-    delete drug;
+  for (auto i = size_; i > index; i--) {
+    drugs_[i] = drugs_[i - 1];
   }
+  drugs_[index] = drug;
+  size_++;
 
-  return drugs_->at(typeID);
+  // TODO::review
+  // if (drug->drug_type()->is_artemisinin()) {
+  //   person_->all_clonal_parasite_populations()->active_astermisinin_on_gametocyte(drug->drug_type());
+  // }
+
+  return &drugs_[index];
+}
 
+void DrugsInBlood::grow() {
+  std::vector<Drug> drugs(2*capacity_);
+  std::copy(drugs_, drugs_ + size_, drugs.begin());
+  spilled_drugs_.swap(drugs);
+  drugs_ = spilled_drugs_.data();
+  capacity_ *= 2;
+}
+
+std::size_t DrugsInBlood::capacity() const {
+  return static_cast<std::size_t>(capacity_);
 }
 
 bool DrugsInBlood::is_drug_in_blood(DrugType *drug_type) const {
@@ -65,69 +83,69 @@ bool DrugsInBlood::is_drug_in_blood(DrugType *drug_type) const {
 }
 
 bool DrugsInBlood::is_drug_in_blood(const int drugTypeID) const {
-  return drugs_->find(drugTypeID)!=drugs_->end();
+  const auto index = lower_bound(drugTypeID);
+  return index < size_ && drugs_[index].drug_type_id() == drugTypeID;
 }
 
-void DrugsInBlood::remove_drug(Drug *drug) const {
-  remove_drug(drug->drug_type()->id());
+void DrugsInBlood::remove_drug(Drug *drug) {
+  remove_drug(drug->drug_type_id());
 }
 
-void DrugsInBlood::remove_drug(const int &drug_type_id) const {
-  auto it = drugs_->find(drug_type_id);
+void DrugsInBlood::remove_drug(const int &drug_type_id) {
+  const auto index = lower_bound(drug_type_id);
 
-  if (it==drugs_->end()) {
+  if (index == size_ || drugs_[index].drug_type_id() != drug_type_id) {
     return;
   }
 
-  delete it->second;
-  drugs_->erase(it);
+  remove_at(index);
+}
+
+void DrugsInBlood::remove_at(const int &index) {
+  for (auto i = index; i + 1 < size_; i++) {
+    drugs_[i] = drugs_[i + 1];
+  }
+  size_--;
 }
 
-Drug *DrugsInBlood::get_drug(const int &type_id) const {
+Drug *DrugsInBlood::get_drug(const int &type_id) {
   if (!is_drug_in_blood(type_id))
     return nullptr;
 
-  return drugs_->at(type_id);
+  return &drugs_[lower_bound(type_id)];
 }
 
 std::size_t DrugsInBlood::size() const {
-  return drugs_->size();
+  return static_cast<std::size_t>(size_);
 }
 
-void DrugsInBlood::clear() const {
-  if (drugs_->empty()) return;
-
-  for (auto &drug : *drugs_) {
-    delete drug.second;
-  }
-  drugs_->clear();
+void DrugsInBlood::clear() {
+  size_ = 0;
 }
 
-void DrugsInBlood::update() const {
-  for (auto &drug : *drugs_) {
-    drug.second->update();
+void DrugsInBlood::update() {
+  for (auto &drug : *this) {
+    drug.update();
   }
 }
 
-void DrugsInBlood::clear_cut_off_drugs_by_event(Event *event) const {
-  if (!drugs_->empty()) {
-    for (auto pos = drugs_->begin(); pos!=drugs_->end();) {
-      //if (pos->second->lastUpdateValue <= 0.1) {
-      //Cut off at 10%
-      if (pos->second->last_update_value() <= DRUG_CUT_OFF_VALUE) {
-        //if drug is astermisinin then deActive Gametocyte
-
-        //TODO::review
-        // if (pos->second->drug_type()->is_artemisinin()) {
-        //   person_->all_clonal_parasite_populations()->deactive_astermisinin_on_gametocyte();
-        // }
-
-        //                person->cancelClearDrugEvent(pos->first, eventID);
-        delete pos->second;
-        drugs_->erase(pos++);
-      } else {
-        ++pos;
-      }
+void DrugsInBlood::clear_cut_off_drugs_by_event(Event *event) {
+  auto kept = 0;
+  for (auto i = 0; i < size_; i++) {
+    //Cut off at 10%
+    if (drugs_[i].is_cut_off()) {
+      //if drug is astermisinin then deActive Gametocyte
+
+      //TODO::review
+      // if (drugs_[i].drug_type()->is_artemisinin()) {
+      //   person_->all_clonal_parasite_populations()->deactive_astermisinin_on_gametocyte();
+      // }
+      continue;
+    }
+    if (kept != i) {
+      drugs_[kept] = drugs_[i];
     }
+    kept++;
   }
+  size_ = kept;
 }
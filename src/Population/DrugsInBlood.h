@@ -8,18 +8,32 @@
 #ifndef DRUGSINBLOOD_H
 #define    DRUGSINBLOOD_H
 
+#include <vector>
 #include "Core/PropertyMacro.h"
 #include "Core/TypeDef.h"
 #include "Core/ObjectPool.h"
+#include "Therapies/Drug.h"
 
-class Person;
+// drugs stored inline, a person rarely has more than the drugs of one therapy in blood
+#ifndef DRUGS_IN_BLOOD_CAPACITY
+#define DRUGS_IN_BLOOD_CAPACITY 4
+#endif
+
+#ifndef DRUG_CUT_OFF_VALUE
+#define DRUG_CUT_OFF_VALUE 0.1
+#endif
 
-class Drug;
+class Person;
 
 class Event;
 
 class DrugType;
 
+/**
+ * Drugs of a person, stored by value and sorted by drug type id in an inline array of DRUGS_IN_BLOOD_CAPACITY drugs
+ * (no heap allocation), which spills to the heap for a person with more drugs. A person has at most one drug per drug
+ * type. Pointers to the drugs are invalidated when a drug is added or removed.
+ */
 class DrugsInBlood {
  OBJECTPOOL(DrugsInBlood)
 
@@ -29,7 +43,8 @@ class DrugsInBlood {
 
  POINTER_PROPERTY(Person, person)
 
- POINTER_PROPERTY(DrugPtrMap, drugs)
+ public:
+  static const int CAPACITY = DRUGS_IN_BLOOD_CAPACITY;
 
  public:
   explicit DrugsInBlood(Person *person = nullptr);
@@ -39,26 +54,65 @@ class DrugsInBlood {
 
   void init();
 
-  Drug *add_drug(Drug *drug);
+  /// adds a copy of drug, or updates the dosing of the drug of the same type already in blood
+  Drug *add_drug(Drug drug);
 
   bool is_drug_in_blood(DrugType *drug_type) const;
 
   bool is_drug_in_blood(int drug_type_id) const;
 
-  void remove_drug(Drug *drug) const;
+  void remove_drug(Drug *drug);
 
-  void remove_drug(const int &drug_type_id) const;
+  void remove_drug(const int &drug_type_id);
 
-  Drug *get_drug(const int &type_id) const;
+  Drug *get_drug(const int &type_id);
 
   std::size_t size() const;
 
-  void clear() const;
+  void clear();
+
+  void update();
+
+  void clear_cut_off_drugs_by_event(Event *event);
+
+  Drug *begin() {
+    return drugs_;
+  }
+
+  Drug *end() {
+    return drugs_ + size_;
+  }
+
+  const Drug *begin() const {
+    return drugs_;
+  }
+
+  const Drug *end() const {
+    return drugs_ + size_;
+  }
+
+  /// number of drugs held without a reallocation
+  std::size_t capacity() const;
+
+ private:
+  // index of the drug of drug_type_id, or of the position where it would be inserted
+  int lower_bound(const int &drug_type_id) const;
+
+  void remove_at(const int &index);
+
+  /// moves the drugs to a heap array of twice the capacity
+  void grow();
+
+  // inline_drugs_, or spilled_drugs_ once the drugs outgrew it
+  Drug *drugs_;
+
+  int size_;
 
-  void update() const;
+  int capacity_;
 
-  void clear_cut_off_drugs_by_event(Event *event) const;
+  Drug inline_drugs_[CAPACITY];
 
+  std::vector<Drug> spilled_drugs_;
 };
 
 #endif    /* DRUGSINBLOOD_H */
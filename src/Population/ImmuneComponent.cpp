@@ -30,34 +30,31 @@ double ImmuneComponent::get_current_value() {
       const auto duration = currentTime - immune_system_->person()->latest_update_time();
 
       const auto age = immune_system_->person()->age();
-      if (immune_system_->increase()) {
-        //increase I(t) = 1 - (1-I0)e^(-b1*t)
-
-        temp = 1 - (1 - latest_value_)*exp(-get_acquire_rate(age)*duration);
-
-        //        temp = lastImmuneLevel;
-        //        double b1 = GetAcquireRate(immuneSystem->person->age);
-        //        for (int i = 0; i < duration; i++) {
-        //            temp+= b1*(1-temp);
-        //        }
-
-      } else {
-        //decrease I(t) = I0 * e ^ (-b2*t);
-        temp = latest_value_*exp(-get_decay_rate(age)*duration);
-        temp = (temp < 0.00001) ? 0.0 : temp;
-      }
-
+      temp = get_value_after_t_days(*Model::CONFIG, latest_value_, immune_system_->increase(), get_acquire_rate(age),
+                                    get_decay_rate(age), duration);
     }
   }
   return temp;
 }
 
+double ImmuneComponent::get_value_after_t_days(Config &config, const double &latest_value, const bool &increase,
+                                               const double &acquire_rate, const double &decay_rate,
+                                               const int &duration) {
+  if (increase) {
+    //increase I(t) = 1 - (1-I0)e^(-b1*t)
+    return 1 - (1 - latest_value)*config.function_tables().exp_minus(acquire_rate*duration);
+  }
+  //decrease I(t) = I0 * e ^ (-b2*t);
+  const auto temp = latest_value*config.function_tables().exp_minus(decay_rate*duration);
+  return (temp < 0.00001) ? 0.0 : temp;
+}
+
 void ImmuneComponent::update() {
   latest_value_ = get_current_value();
 
 }
 
 void ImmuneComponent::draw_random_immune() {
-  const auto ims = Model::CONFIG->immune_system_information();
+  const auto &ims = Model::CONFIG->immune_system_information();
   latest_value_ = Model::RANDOM->random_beta(ims.alpha_immune, ims.beta_immune);
 }
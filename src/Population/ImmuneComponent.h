@@ -15,6 +15,8 @@ class ImmuneSystem;
 
 class Model;
 
+class Config;
+
 class ImmuneComponent {
   //    //OBJECTPOOL(ImmuneComponent)
  DISALLOW_COPY_AND_ASSIGN(ImmuneComponent)
@@ -35,6 +37,10 @@ class ImmuneComponent {
 
   virtual double get_current_value();
 
+  /// immune value duration days after latest_value: I(t) = 1 - (1-I0)e^(-b1*t) when increasing, I0*e^(-b2*t) else
+  static double get_value_after_t_days(Config &config, const double &latest_value, const bool &increase,
+                                       const double &acquire_rate, const double &decay_rate, const int &duration);
+
   virtual double get_decay_rate(const int &age = 0) const = 0;
 
   virtual double get_acquire_rate(const int &age = 0) const = 0;
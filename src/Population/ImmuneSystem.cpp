@@ -63,24 +63,26 @@ double ImmuneSystem::get_current_value() const {
 double ImmuneSystem::get_parasite_size_after_t_days(const int &duration, const double &originalSize,
                                                     const double &fitness) const {
 
-  const auto last_immune_level = get_lastest_immune_value();
-  const auto temp = Model::CONFIG->immune_system_information().c_max*(1 - last_immune_level) + Model::CONFIG
-      ->immune_system_information()
-      .c_min*
-      last_immune_level;
+  return get_parasite_size_after_t_days(Model::CONFIG->immune_system_information(), get_lastest_immune_value(),
+                                        duration, originalSize, fitness);
+}
+
+double ImmuneSystem::get_parasite_size_after_t_days(const ImmuneSystemInformation &isf, const double &immune,
+                                                    const int &duration, const double &originalSize,
+                                                    const double &fitness) {
+  const auto temp = isf.c_max*(1 - immune) + isf.c_min*immune;
 
   const auto value = originalSize + duration*(log10(temp) + log10(fitness));
   return value;
-
 }
 
 const double mid_point = 0.4;
 
 double ImmuneSystem::get_clinical_progression_probability() const {
-  const auto immune = get_current_value();
-
-  const auto isf = Model::CONFIG->immune_system_information();
+  return Model::CONFIG->function_tables().clinical_progression(get_current_value());
+}
 
+double ImmuneSystem::get_clinical_progression_probability(const ImmuneSystemInformation &isf, const double &immune) {
   //    double PClinical = (isf.min_clinical_probability - isf.max_clinical_probability) * pow(immune, isf.immune_effect_on_progression_to_clinical) + isf.max_clinical_probability;
 
   //    const double p_m = 0.99;
@@ -53,8 +53,16 @@ class ImmuneSystem {
   virtual double
   get_parasite_size_after_t_days(const int &duration, const double &originalSize, const double &fitness) const;
 
+  /// log10 parasite density after duration days of growth from originalSize with the given immune level
+  static double get_parasite_size_after_t_days(const ImmuneSystemInformation &isf, const double &immune,
+                                               const int &duration, const double &originalSize,
+                                               const double &fitness);
+
   virtual double get_clinical_progression_probability() const;
 
+  /// exact probability to progress to clinical for a given immune level
+  static double get_clinical_progression_probability(const ImmuneSystemInformation &isf, const double &immune);
+
 };
 
 #endif    /* IMMUNESYSTEM_H */
@@ -9,6 +9,7 @@
 #include "Model.h"
 #include "Person.h"
 #include "ImmuneSystem.h"
+#include "Core/Config/Config.h"
 #include <cmath>
 
 //OBJECTPOOL_IMPL(InfantImmuneComponent)
@@ -22,7 +23,7 @@ double InfantImmuneComponent::get_acquire_rate(const int &age) const {
 }
 
 double InfantImmuneComponent::get_decay_rate(const int &age) const {
-  return 0.0315;
+  return DECAY_RATE;
 }
 
 double InfantImmuneComponent::get_current_value() {
@@ -31,9 +32,14 @@ double InfantImmuneComponent::get_current_value() {
   if (immune_system()!=nullptr) {
     if (immune_system()->person()!=nullptr) {
       const auto duration = current_time - immune_system()->person()->latest_update_time();
-      //decrease I(t) = I0 * e ^ (-b2*t);
-      temp = latest_value()*exp(-get_decay_rate(0)*duration);
+      temp = get_value_after_t_days(*Model::CONFIG, latest_value(), duration);
     }
   }
   return temp;
 }
+
+double InfantImmuneComponent::get_value_after_t_days(Config &config, const double &latest_value,
+                                                     const int &duration) {
+  //decrease I(t) = I0 * e ^ (-b2*t);
+  return latest_value*config.function_tables().exp_minus(DECAY_RATE*duration);
+}
@@ -16,6 +16,8 @@ class InfantImmuneComponent : public ImmuneComponent {
  DISALLOW_COPY_AND_ASSIGN(InfantImmuneComponent)
 
  public:
+  static constexpr double DECAY_RATE = 0.0315;
+
   explicit InfantImmuneComponent(ImmuneSystem *immune_system = nullptr);
 
   // InfantImmuneComponent(const InfantImmuneComponent& orig);
@@ -27,6 +29,9 @@ class InfantImmuneComponent : public ImmuneComponent {
 
   double get_current_value() override;
 
+  /// decrease I(t) = I0 * e ^ (-b2*t), the immune value is not reset to 0 at low levels as in ImmuneComponent
+  static double get_value_after_t_days(Config &config, const double &latest_value, const int &duration);
+
 };
 
 #endif    /* INFANTIMMUNECOMPONENT_H */
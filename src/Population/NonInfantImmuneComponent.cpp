@@ -21,8 +21,12 @@ NonInfantImmuneComponent::~NonInfantImmuneComponent() {
 double NonInfantImmuneComponent::get_acquire_rate(const int &age) const {
   //    return FastImmuneComponent::acquireRate;
 
-  return (age > 80) ? Model::CONFIG->immune_system_information().acquire_rate_by_age[80]
-                    : Model::CONFIG->immune_system_information().acquire_rate_by_age[age];
+  return acquire_rate_by_age(*Model::CONFIG, age);
+}
+
+double NonInfantImmuneComponent::acquire_rate_by_age(Config &config, const int &age) {
+  return (age > 80) ? config.immune_system_information().acquire_rate_by_age[80]
+                    : config.immune_system_information().acquire_rate_by_age[age];
 
 }
 
@@ -24,6 +24,8 @@ class NonInfantImmuneComponent : public ImmuneComponent {
 
   virtual double get_acquire_rate(const int &age = 0) const;
 
+  static double acquire_rate_by_age(Config &config, const int &age);
+
  private:
 
 };
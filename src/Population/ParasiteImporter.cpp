@@ -0,0 +1,106 @@
+//
+// ParasiteImporter.cpp
+//
+
+#include "ParasiteImporter.h"
+#include "Model.h"
+#include "Core/Config/Config.h"
+#include "Core/Random.h"
+#include "Population/Population.h"
+#include "Population/ImmuneSystem.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Population/Properties/PersonIndexByLocationStateAgeClass.h"
+
+SubsetSampler ParasiteImporter::host_sampler_;
+
+MultinomialSampler ParasiteImporter::age_class_sampler_;
+
+PersonPtrVector ParasiteImporter::hosts_;
+
+ImportationSpec::ImportationSpec(const int &location, const double &number_of_cases, const IntVector &genotype_ids,
+                                 const DoubleVector &genotype_weights) : location(location),
+                                                                         number_of_cases(number_of_cases),
+                                                                         genotype_ids(genotype_ids),
+                                                                         genotype_table(genotype_weights) {}
+
+int ImportationSpec::draw_genotype_id(Random *random) const {
+  return genotype_ids.size()==1 ? genotype_ids[0] : genotype_ids[genotype_table.sample(random)];
+}
+
+void ParasiteImporter::import(const ImportationSpec &spec, const int &number_of_cases) {
+  if (number_of_cases <= 0) {
+    return;
+  }
+  static const std::vector<Person::HostStates> susceptible{Person::SUSCEPTIBLE};
+
+  const auto number_of_age_classes = Model::CONFIG->number_of_age_classes();
+  auto &weights = age_class_sampler_.weights(number_of_age_classes);
+  std::fill(weights.begin(), weights.end(), 1.0);
+  const auto &cases_by_age_class = age_class_sampler_.sample(Model::RANDOM, number_of_cases);
+
+  for (auto ac = 0; ac < number_of_age_classes; ac++) {
+    if (cases_by_age_class[ac]==0) {
+      continue;
+    }
+    for (auto *p : draw_hosts(spec.location, susceptible, ac, cases_by_age_class[ac])) {
+      infect(p, Model::CONFIG->genotype_db()->at(spec.draw_genotype_id(Model::RANDOM)));
+    }
+  }
+}
+
+void ParasiteImporter::convert(const int &location, const double &fraction, const GenotypeConversion &conversion) {
+  static const std::vector<Person::HostStates> infected{Person::ASYMPTOMATIC, Person::CLINICAL};
+  auto *pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
+
+  for (auto ac = 0; ac < Model::CONFIG->number_of_age_classes(); ac++) {
+    const auto number_infected_individual_in_ac =
+        pi->vPerson()[location][Person::ASYMPTOMATIC][ac].size() + pi->vPerson()[location][Person::CLINICAL][ac].size();
+    const auto number_of_cases = Model::RANDOM->random_poisson(number_infected_individual_in_ac*fraction);
+    if (number_of_cases==0) {
+      continue;
+    }
+    for (auto *p : draw_hosts(location, infected, ac, number_of_cases)) {
+      p->all_clonal_parasite_populations()->change_all_genotypes(conversion);
+    }
+  }
+}
+
+const PersonPtrVector &ParasiteImporter::draw_hosts(const int &location,
+                                                   const std::vector<Person::HostStates> &host_states,
+                                                   const int &age_class, const std::size_t &number_of_hosts) {
+  auto *pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
+  std::size_t number_of_persons = 0;
+  for (auto hs : host_states) {
+    number_of_persons += pi->vPerson()[location][hs][age_class].size();
+  }
+
+  hosts_.clear();
+  for (auto position : host_sampler_.sample(Model::RANDOM, number_of_persons, number_of_hosts)) {
+    // position in the concatenation of the host state lists
+    for (auto hs : host_states) {
+      const auto &persons = pi->vPerson()[location][hs][age_class];
+      if (position < persons.size()) {
+        hosts_.push_back(persons[position]);
+        break;
+      }
+      position -= persons.size();
+    }
+  }
+  return hosts_;
+}
+
+void ParasiteImporter::infect(Person *p, Genotype *genotype) {
+  p->leave_compartment();
+  p->immune_system()->set_increase(true);
+  p->set_host_state(Person::ASYMPTOMATIC);
+
+  // the clone is set up before it enters the host
+  auto *blood_parasite = new ClonalParasitePopulation(genotype);
+  blood_parasite->set_gametocyte_level(Model::CONFIG->gametocyte_level_full());
+  blood_parasite->set_last_update_log10_parasite_density(
+      Model::CONFIG->parasite_density_level().log_parasite_density_asymptomatic);
+  blood_parasite->set_update_function(Model::MODEL->immunity_clearance_update_function());
+
+  p->all_clonal_parasite_populations()->add_infection(blood_parasite);
+}
@@ -0,0 +1,83 @@
+//
+// ParasiteImporter.h
+//
+
+#ifndef PARASITEIMPORTER_H
+#define PARASITEIMPORTER_H
+
+#include <functional>
+#include "Core/AliasTable.h"
+#include "Core/MultinomialSampler.h"
+#include "Core/SubsetSampler.h"
+#include "Core/TypeDef.h"
+#include "Population/Person.h"
+
+class Genotype;
+
+class Random;
+
+/**
+ * What one importation brings into a location: the expected number of cases and the distribution of their genotypes.
+ * When and how often a spec is executed is left to the event holding it.
+ */
+struct ImportationSpec {
+  int location{0};
+
+  double number_of_cases{0};
+
+  IntVector genotype_ids;
+
+  AliasTable genotype_table;
+
+  ImportationSpec() = default;
+
+  ImportationSpec(const int &location, const double &number_of_cases, const IntVector &genotype_ids,
+                  const DoubleVector &genotype_weights);
+
+  /// genotype of one imported case
+  int draw_genotype_id(Random *random) const;
+};
+
+/**
+ * ParasiteImporter applies importations and mutant introductions to the population in batches: the hosts are drawn
+ * in bulk, without replacement, over the lists of PersonIndexByLocationStateAgeClass, and each host gets its new
+ * infection (or its converted clones) with a single update of its force of infection and genotype census.
+ */
+class ParasiteImporter {
+ public:
+  /// new genotype of a clone given its current genotype
+  typedef std::function<Genotype *(Genotype *)> GenotypeConversion;
+
+ public:
+  /**
+   * Imports number_of_cases asymptomatic infections into the susceptible persons of spec.location. As with picking
+   * an age class then a person for each case, the cases are spread evenly over the age classes, and cases falling in
+   * an age class without enough susceptible persons are lost.
+   */
+  static void import(const ImportationSpec &spec, const int &number_of_cases);
+
+  /**
+   * Draws Poisson(fraction x number of infected persons) infected (asymptomatic or clinical) persons in each age class
+   * of location and converts the genotype of all their clones.
+   */
+  static void convert(const int &location, const double &fraction, const GenotypeConversion &conversion);
+
+  /**
+   * Draws number_of_hosts distinct persons (at most all of them) among the persons of location and age_class in the
+   * given host states.
+   */
+  static const PersonPtrVector &draw_hosts(const int &location, const std::vector<Person::HostStates> &host_states,
+                                           const int &age_class, const std::size_t &number_of_hosts);
+
+  /// new asymptomatic infection of genotype in p
+  static void infect(Person *p, Genotype *genotype);
+
+ private:
+  static SubsetSampler host_sampler_;
+
+  static MultinomialSampler age_class_sampler_;
+
+  static PersonPtrVector hosts_;
+};
+
+#endif // PARASITEIMPORTER_H
@@ -30,7 +30,6 @@
 #include "Events/ReturnToResidenceEvent.h"
 #include "Events/CirculateToTargetLocationNextDayEvent.h"
 #include "MDC/ModelDataCollector.h"
-#include "Events/BirthdayEvent.h"
 #include "Therapies/MACTherapy.h"
 #include "Events/ReceiveTherapyEvent.h"
 #include "Constants.h"
@@ -42,6 +41,7 @@ OBJECTPOOL_IMPL(Person)
 
 Person::Person() :
   location_(-1), residence_location_(-1), host_state_(SUSCEPTIBLE), age_(-1), age_class_(-1), birthday_(-1),
+  birth_year_(0), birth_month_day_(-1),
   latest_update_time_(-1), bitting_level_(-1), base_bitting_level_value_(0), moving_level_(-1),
   liver_parasite_type_(nullptr),
   number_of_times_bitten_(0),
@@ -107,7 +107,9 @@ void Person::set_location(const int &value) {
 
     NotifyChange(LOCATION, &location_, &value);
 
+    all_clonal_parasite_populations_->remove_from_genotype_census();
     location_ = value;
+    all_clonal_parasite_populations_->add_to_genotype_census();
     all_clonal_parasite_populations_->add_all_infection_force();
   }
 }
@@ -126,7 +128,7 @@ void Person::set_host_state(const HostStates &value) {
 
       //
       //            Model::STATISTIC->update_person_days_by_years(location_, -(Constants::DAYS_IN_YEAR() - Model::SCHEDULER->current_day_in_year()));
-      Model::DATA_COLLECTOR->record_1_death(location_, birthday_, number_of_times_bitten_, age_class_, age_);
+      Model::DATA_COLLECTOR->record_1_death(location_, birthday_, number_of_times_bitten_, age_class_, age());
     }
 
     host_state_ = value;
@@ -135,7 +137,14 @@ void Person::set_host_state(const HostStates &value) {
 }
 
 int Person::age() const {
-  return age_;
+  if (!has_birth_date() || Model::SCHEDULER == nullptr) {
+    return age_;
+  }
+  return age_on(Model::SCHEDULER->today(), birth_year_, birth_month_day_);
+}
+
+int Person::age_on(const SimulationCalendar::Day &today, const int &birth_year, const int &birth_month_day) {
+  return today.year - birth_year - (today.month_day() < birth_month_day ? 1 : 0);
 }
 
 void Person::set_age(const int &value) {
@@ -149,15 +158,44 @@ void Person::set_age(const int &value) {
 
     //update age class
     if (Model::MODEL != nullptr) {
-      auto ac = age_class_ == -1 ? 0 : age_class_;
+      update_age_class();
+    }
+  }
+}
 
-      while (ac < (Model::CONFIG->number_of_age_classes() - 1) && age_ >= Model::CONFIG->age_structure()[ac]) {
-        ac++;
-      }
+void Person::update_age_class() {
+  set_age_class(age_class_of(*Model::CONFIG, age(), age_class_ == -1 ? 0 : age_class_));
+}
 
-      set_age_class(ac);
-    }
+int Person::age_class_of(Config &config, const int &age, const int &from) {
+  auto ac = from;
+  while (ac < (config.number_of_age_classes() - 1) && age >= config.age_structure()[ac]) {
+    ac++;
   }
+  return ac;
+}
+
+void Person::set_next_birthday(const int &time) {
+  const auto next_birthday = Model::SCHEDULER->calendar().day_of(
+      date::sys_days{Model::SCHEDULER->calendar().starting_date() + date::days{time}});
+  birth_year_ = next_birthday.year - (age_ + 1);
+  birth_month_day_ = next_birthday.month_day();
+}
+
+void Person::set_birth_date(const int &year, const int &month_day) {
+  birth_year_ = year;
+  birth_month_day_ = month_day;
+}
+
+bool Person::has_birth_date() const {
+  return birth_month_day_ >= 0;
+}
+
+int Person::time_of_age(const int &age) const {
+  // Feb 29 of a common year falls on Mar 1, as in age()
+  const date::year_month_day birthday{date::year{birth_year_ + age}, date::month{
+      static_cast<unsigned>(birth_month_day_/100)}, date::day{static_cast<unsigned>(birth_month_day_%100)}};
+  return Model::SCHEDULER->time_of(date::sys_days{birthday});
 }
 
 int Person::age_class() const {
@@ -204,10 +242,6 @@ void Person::set_moving_level(const int &value) {
   }
 }
 
-void Person::increase_age_by_1_year() {
-  set_age(age_ + 1);
-}
-
 ImmuneSystem* Person::immune_system() const {
   return immune_system_;
 }
@@ -253,11 +287,7 @@ double Person::get_biting_level_value() {
 }
 
 double Person::relative_infectivity(const double &log10_parasite_density) {
-  const auto d_n = log10_parasite_density * Model::CONFIG->relative_infectivity().sigma +
-                   Model::CONFIG->relative_infectivity().ro_star;
-  const auto p = Model::RANDOM->cdf_standard_normal_distribution(d_n);
-
-  return p * p + 0.01;
+  return Model::CONFIG->function_tables().relative_infectivity(log10_parasite_density);
 }
 
 double Person::get_probability_progress_to_clinical() {
@@ -302,21 +332,29 @@ Person::change_all_parasite_update_function(ParasiteDensityUpdateFunction* from,
 }
 
 bool Person::will_progress_to_death_when_receive_no_treatment() {
-  //yes == death
-  const auto p = Model::RANDOM->random_flat(0.0, 1.0);
-  return p <= Model::CONFIG->mortality_when_treatment_fail_by_age_class()[age_class_];
+  return will_progress_to_death_when_receive_no_treatment(*Model::CONFIG, *Model::RANDOM, age_class_);
 }
 
 bool Person::will_progress_to_death_when_recieve_treatment() {
+  return will_progress_to_death_when_recieve_treatment(*Model::CONFIG, *Model::RANDOM, age_class_);
+}
+
+bool Person::will_progress_to_death_when_receive_no_treatment(Config &config, Random &random, const int &age_class) {
+  //yes == death
+  const auto p = random.random_flat(0.0, 1.0);
+  return p <= config.mortality_when_treatment_fail_by_age_class()[age_class];
+}
+
+bool Person::will_progress_to_death_when_recieve_treatment(Config &config, Random &random, const int &age_class) {
   //yes == death
-  double P = Model::RANDOM->random_flat(0.0, 1.0);
+  double P = random.random_flat(0.0, 1.0);
   // 90% lower than no treatment
-  return P <= Model::CONFIG->mortality_when_treatment_fail_by_age_class()[age_class_] * (1 - 0.9);
+  return P <= config.mortality_when_treatment_fail_by_age_class()[age_class] * (1 - 0.9);
 }
 
 void Person::schedule_progress_to_clinical_event_by(ClonalParasitePopulation* blood_parasite) {
 
-  const auto time = (age_ <= 5)
+  const auto time = (age() <= 5)
                     ? Model::CONFIG->days_to_clinical_under_five()
                     : Model::CONFIG->days_to_clinical_over_five();
 
@@ -325,12 +363,9 @@ void Person::schedule_progress_to_clinical_event_by(ClonalParasitePopulation* bl
 }
 
 void Person::schedule_end_clinical_due_to_drug_resistance_event(ClonalParasitePopulation* blood_parasite) {
-
-  auto d_clinical = Model::RANDOM->random_normal(7, 2);
-  d_clinical = std::min<int>(std::max<int>(d_clinical, 5), 14);
-
   EndClinicalDueToDrugResistanceEvent::schedule_event(Model::SCHEDULER, this, blood_parasite,
-                                                      Model::SCHEDULER->current_time() + d_clinical);
+                                                      Model::SCHEDULER->current_time()
+                                                          + draw_clinical_duration(*Model::RANDOM));
 }
 
 void Person::schedule_test_treatment_failure_event(ClonalParasitePopulation* blood_parasite, const int &testing_day,
@@ -340,19 +375,25 @@ void Person::schedule_test_treatment_failure_event(ClonalParasitePopulation* blo
 }
 
 int Person::complied_dosing_days(const int &dosing_day) const {
+  return complied_dosing_days(*Model::CONFIG, *Model::RANDOM, dosing_day);
+}
 
-  if (Model::CONFIG->p_compliance() < 1) {
-    const auto p = Model::RANDOM->random_flat(0.0, 1.0);
-    if (p > Model::CONFIG->p_compliance()) {
+int Person::complied_dosing_days(Config &config, Random &random, const int &dosing_day) {
+
+  if (config.p_compliance() < 1) {
+    const auto p = random.random_flat(0.0, 1.0);
+    if (p > config.p_compliance()) {
       //do not comply
-      const auto a = (Model::CONFIG->min_dosing_days() - dosing_day) / (1 - Model::CONFIG->p_compliance());
-      return static_cast<int>(std::ceil(a * p + Model::CONFIG->min_dosing_days() - a));
+      const auto a = (config.min_dosing_days() - dosing_day) / (1 - config.p_compliance());
+      return static_cast<int>(std::ceil(a * p + config.min_dosing_days() - a));
     }
   }
   return dosing_day;
 }
 
 void Person::receive_therapy(Therapy* therapy, ClonalParasitePopulation* clinical_caused_parasite) {
+  leave_compartment();
+
   //if therapy is SCTherapy
   auto* sc_therapy = dynamic_cast<SCTherapy*>(therapy);
   if (sc_therapy != nullptr) {
@@ -394,24 +435,28 @@ void Person::receive_therapy(Therapy* therapy, ClonalParasitePopulation* clinica
 }
 
 void Person::add_drug_to_blood(DrugType* dt, const int &dosing_days) {
-  auto* drug = new Drug(dt);
-  drug->set_dosing_days(dosing_days);
-  drug->set_last_update_time(Model::SCHEDULER->current_time());
+  Drug drug(dt);
+  drug.set_dosing_days(dosing_days);
+  drug.set_last_update_time(Model::SCHEDULER->current_time());
 
-  const auto sd = dt->age_group_specific_drug_concentration_sd()[age_class_];
-  //    std::cout << ageClass << "====" << sd << std::endl;
-  const auto drug_level = Model::RANDOM->random_normal_truncated(1.0, sd);
+  const auto drug_level = draw_drug_level(dt, *Model::RANDOM, age_class_);
 
-  drug->set_last_update_value(drug_level);
-  drug->set_starting_value(drug_level);
+  drug.set_last_update_value(drug_level);
+  drug.set_starting_value(drug_level);
 
-  drug->set_start_time(Model::SCHEDULER->current_time());
-  drug->set_end_time(Model::SCHEDULER->current_time() + dt->get_total_duration_of_drug_activity(dosing_days));
+  drug.set_start_time(Model::SCHEDULER->current_time());
+  drug.set_end_time(Model::SCHEDULER->current_time() + dt->get_total_duration_of_drug_activity(dosing_days));
 
   drugs_in_blood_->add_drug(drug);
 
 }
 
+double Person::draw_drug_level(DrugType* dt, Random &random, const int &age_class) {
+  const auto sd = dt->age_group_specific_drug_concentration_sd()[age_class];
+  //    std::cout << ageClass << "====" << sd << std::endl;
+  return random.random_normal_truncated(1.0, sd);
+}
+
 void Person::schedule_update_by_drug_event(ClonalParasitePopulation* clinical_caused_parasite) {
 
   UpdateWhenDrugIsPresentEvent::schedule_event(Model::SCHEDULER, this, clinical_caused_parasite,
@@ -419,22 +464,19 @@ void Person::schedule_update_by_drug_event(ClonalParasitePopulation* clinical_ca
 }
 
 void Person::schedule_end_clinical_event(ClonalParasitePopulation* clinical_caused_parasite) {
-
-  int dClinical = Model::RANDOM->random_normal(7, 2);
-  dClinical = std::min<int>(std::max<int>(dClinical, 5), 14);
-
   EndClinicalEvent::schedule_event(Model::SCHEDULER, this, clinical_caused_parasite,
-                                   Model::SCHEDULER->current_time() + dClinical);
+                                   Model::SCHEDULER->current_time() + draw_clinical_duration(*Model::RANDOM));
 }
 
 void Person::schedule_end_clinical_by_no_treatment_event(ClonalParasitePopulation* clinical_caused_parasite) {
-
-  auto d_clinical = Model::RANDOM->random_normal(7, 2);
-  d_clinical = std::min<int>(std::max<int>(d_clinical, 5), 14);
-
   EndClinicalByNoTreatmentEvent::schedule_event(Model::SCHEDULER, this, clinical_caused_parasite,
-                                                Model::SCHEDULER->current_time() + d_clinical);
+                                                Model::SCHEDULER->current_time()
+                                                    + draw_clinical_duration(*Model::RANDOM));
+}
 
+int Person::draw_clinical_duration(Random &random) {
+  int d_clinical = random.random_normal(7, 2);
+  return std::min<int>(std::max<int>(d_clinical, 5), 14);
 }
 
 void Person::change_state_when_no_parasite_in_blood() {
@@ -455,9 +497,7 @@ void Person::change_state_when_no_parasite_in_blood() {
 
 void Person::determine_relapse_or_not(ClonalParasitePopulation* clinical_caused_parasite) {
   if (all_clonal_parasite_populations_->contain(clinical_caused_parasite)) {
-    const auto p = Model::RANDOM->random_flat(0.0, 1.0);
-
-    if (p <= Model::CONFIG->p_relapse()) {
+    if (will_relapse(*Model::CONFIG, *Model::RANDOM)) {
       //        if (P <= get_probability_progress_to_clinical()) {
       //progress to clinical after several days
       clinical_caused_parasite->set_update_function(Model::MODEL->progress_to_clinical_update_function());
@@ -478,6 +518,11 @@ void Person::determine_relapse_or_not(ClonalParasitePopulation* clinical_caused_
   }
 }
 
+bool Person::will_relapse(Config &config, Random &random) {
+  const auto p = random.random_flat(0.0, 1.0);
+  return p <= config.p_relapse();
+}
+
 void Person::determine_clinical_or_not(ClonalParasitePopulation* clinical_caused_parasite) {
   if (all_clonal_parasite_populations_->contain(clinical_caused_parasite)) {
     const auto p = Model::RANDOM->random_flat(0.0, 1.0);
@@ -505,10 +550,14 @@ void Person::determine_clinical_or_not(ClonalParasitePopulation* clinical_caused
 
 void Person::schedule_relapse_event(ClonalParasitePopulation* clinical_caused_parasite, const int &time_until_relapse) {
 
-  int duration = Model::RANDOM->random_normal(time_until_relapse, 15);
-  duration = std::min<int>(std::max<int>(duration, time_until_relapse - 15), time_until_relapse + 15);
   ProgressToClinicalEvent::schedule_event(Model::SCHEDULER, this, clinical_caused_parasite,
-                                          Model::SCHEDULER->current_time() + duration);
+                                          Model::SCHEDULER->current_time()
+                                              + draw_relapse_duration(*Model::RANDOM, time_until_relapse));
+}
+
+int Person::draw_relapse_duration(Random &random, const int &time_until_relapse) {
+  int duration = random.random_normal(time_until_relapse, 15);
+  return std::min<int>(std::max<int>(duration, time_until_relapse - 15), time_until_relapse + 15);
 }
 
 void Person::update() {
@@ -601,6 +650,8 @@ void Person::randomly_choose_parasite() {
 void Person::infected_by(const int &parasite_type_id) {
   //only infect if liver is available :D
   if (liver_parasite_type_ == nullptr) {
+    leave_compartment();
+
     if (host_state_ == SUSCEPTIBLE) {
       set_host_state(EXPOSED);
     }
@@ -620,7 +671,7 @@ void Person::schedule_move_parasite_to_blood(Genotype* genotype, const int &time
 }
 
 void Person::schedule_mature_gametocyte_event(ClonalParasitePopulation* clinical_caused_parasite) {
-  const auto day_mature_gametocyte = (age_ <= 5)
+  const auto day_mature_gametocyte = (age() <= 5)
                                      ? Model::CONFIG->days_mature_gametocyte_under_five()
                                      : Model::CONFIG->days_mature_gametocyte_over_five();
   MatureGametocyteEvent::schedule_event(Model::SCHEDULER, this, clinical_caused_parasite,
@@ -693,16 +744,6 @@ void Person::move_to_population(Population* target_population) {
   target_population->add_person(this);
 }
 
-bool Person::has_birthday_event() const {
-
-  for (Event* e : *events()) {
-    if (dynamic_cast<BirthdayEvent*>(e) != nullptr) {
-      return true;
-    }
-  }
-  return false;
-}
-
 bool Person::has_update_by_having_drug_event() const {
 
   for (Event* e : *events()) {
@@ -714,6 +755,7 @@ bool Person::has_update_by_having_drug_event() const {
 }
 
 double Person::get_age_dependent_biting_factor() const {
+  const auto current_age = age();
   //
   //0.00 - 0.25  -  6.5
   //0.25 - 0.50  -  8.0
@@ -726,7 +768,7 @@ double Person::get_age_dependent_biting_factor() const {
   // + 2.75kg until 20
   // then divide by 61.5
 
-  if (age_ < 1) {
+  if (current_age < 1) {
     const auto age = ((Model::SCHEDULER->current_time() - birthday_) % Constants::DAYS_IN_YEAR()) /
                      static_cast<double>(Constants::DAYS_IN_YEAR());
     if (age < 0.25)
@@ -737,19 +779,35 @@ double Person::get_age_dependent_biting_factor() const {
       return 0.1463;
     return 0.1545;
   }
-  if (age_ < 2)
+  if (current_age < 2)
     return 0.1789;
-  if (age_ < 3)
+  if (current_age < 3)
     return 0.2195;
-  if (age_ < 4)
+  if (current_age < 4)
     return 0.2520;
-  if (age_ < 20)
-    return (17.5 + (age_ - 4) * 2.75) / 61.5;
+  if (current_age < 20)
+    return (17.5 + (current_age - 4) * 2.75) / 61.5;
   return 1.0;
 }
 
 double Person::p_infection_from_an_infectious_bite() const {
-  return (1 - immune_system_->get_current_value()) / 8.333 + 0.04;
+  return p_infection_from_an_infectious_bite(immune_system_->get_current_value());
+}
+
+double Person::p_infection_from_an_infectious_bite(const double &immune_value) {
+  return (1 - immune_value) / 8.333 + 0.04;
+}
+
+bool Person::can_join_compartment() const {
+  return host_state_ == SUSCEPTIBLE && liver_parasite_type_ == nullptr && all_clonal_parasite_populations_->size() == 0
+         && drugs_in_blood_->size() == 0
+         && !(Model::CONFIG->using_age_dependent_bitting_level() && age() < 20);
+}
+
+void Person::leave_compartment() {
+  if (in_compartment()) {
+    population_->move_out_of_compartment(this);
+  }
 }
 
 bool Person::isGametocytaemic() const {
@@ -770,7 +828,7 @@ void Person::generate_prob_present_at_mda_by_age() {
 double Person::prob_present_at_mda() {
   auto i = 0;
   // std::cout << "hello " << i << std::endl;
-  while (age_ > Model::CONFIG->age_bracket_prob_individual_present_at_mda()[i]
+  while (age() > Model::CONFIG->age_bracket_prob_individual_present_at_mda()[i]
          && i < Model::CONFIG->age_bracket_prob_individual_present_at_mda().size()) {
     i++;
   }
@@ -779,8 +837,8 @@ double Person::prob_present_at_mda() {
 }
 
 bool Person::has_effective_drug_in_blood() const {
-  for (const auto &kv_drug : *drugs_in_blood_->drugs()) {
-    if (kv_drug.second->last_update_value() > 0.5) return true;
+  for (const auto &drug : *drugs_in_blood_) {
+    if (drug.last_update_value() > 0.5) return true;
   }
   return false;
 }
@@ -13,8 +13,11 @@
 #include "Properties/PersonIndexByLocationStateAgeClassHandler.h"
 #include "Core/ObjectPool.h"
 #include "Core/Dispatcher.h"
+#include "Core/SimulationCalendar.h"
 #include "Properties/PersonIndexByLocationBittingLevelHandler.h"
 #include "Properties/PersonIndexByLocationMovingLevelHandler.h"
+#include "Properties/PersonIndexByAgeClassTransitionHandler.h"
+#include "Properties/PersonIndexByCompartmentHandler.h"
 #include "ClonalParasitePopulation.h"
 
 class Population;
@@ -51,6 +54,7 @@ class Genotype;
 
 class Person : public PersonIndexAllHandler, public PersonIndexByLocationStateAgeClassHandler,
                public PersonIndexByLocationBittingLevelHandler, public PersonIndexByLocationMovingLevelHandler,
+               public PersonIndexByAgeClassTransitionHandler, public PersonIndexByCompartmentHandler,
                public Dispatcher {
  public:
 
@@ -95,6 +99,11 @@ class Person : public PersonIndexAllHandler, public PersonIndexByLocationStateAg
   // if birthday is -100 which is that person was born 100 day before the simulation start
  PROPERTY_REF(int, birthday)
 
+  // the age is derived from the calendar once the birth date is set, see set_next_birthday
+ READ_ONLY_PROPERTY_REF(int, birth_year)
+
+ READ_ONLY_PROPERTY_REF(int, birth_month_day)
+
  POINTER_PROPERTY_HEADER(ImmuneSystem, immune_system)
 
  POINTER_PROPERTY(SingleHostClonalParasitePopulations, all_clonal_parasite_populations)
@@ -139,7 +148,28 @@ class Person : public PersonIndexAllHandler, public PersonIndexByLocationStateAg
 
   void NotifyChange(const Property &property, const void *oldValue, const void *newValue);
 
-  virtual void increase_age_by_1_year();
+  /**
+   * Sets the birth date from the current age and the simulation time of the next birthday, after which age() follows
+   * the calendar and the age class is updated by PersonIndexByAgeClassTransition.
+   */
+  void set_next_birthday(const int &time);
+
+  /// sets the birth date of a person born on a day of the given year and month_day, see SimulationCalendar::month_day
+  void set_birth_date(const int &year, const int &month_day);
+
+  bool has_birth_date() const;
+
+  /// simulation time of the birthday on which the person turns age
+  int time_of_age(const int &age) const;
+
+  /// age on today of a person born on birth_year and birth_month_day, as age()
+  static int age_on(const SimulationCalendar::Day &today, const int &birth_year, const int &birth_month_day);
+
+  /// age class of the current age
+  void update_age_class();
+
+  /// age class of age, searched from age class from
+  static int age_class_of(Config &config, const int &age, const int &from = 0);
 
   //    BloodParasite* add_new_parasite_to_blood(Genotype* parasite_type);
   ClonalParasitePopulation *add_new_parasite_to_blood(Genotype *parasite_type) const;
@@ -158,6 +188,10 @@ class Person : public PersonIndexAllHandler, public PersonIndexByLocationStateAg
 
   virtual bool will_progress_to_death_when_recieve_treatment();
 
+  static bool will_progress_to_death_when_receive_no_treatment(Config &config, Random &random, const int &age_class);
+
+  static bool will_progress_to_death_when_recieve_treatment(Config &config, Random &random, const int &age_class);
+
   void cancel_all_other_progress_to_clinical_events_except(Event *event) const;
 
   void cancel_all_events_except(Event *event) const;
@@ -168,10 +202,15 @@ class Person : public PersonIndexAllHandler, public PersonIndexByLocationStateAg
 
   int complied_dosing_days(const int &dosing_day) const;
 
+  static int complied_dosing_days(Config &config, Random &random, const int &dosing_day);
+
   void receive_therapy(Therapy *therapy, ClonalParasitePopulation *clinical_caused_parasite);
 
   void add_drug_to_blood(DrugType *dt, const int &dosing_days);
 
+  /// starting concentration of a drug given to a person of age_class
+  static double draw_drug_level(DrugType *dt, Random &random, const int &age_class);
+
   void schedule_progress_to_clinical_event_by(ClonalParasitePopulation *blood_parasite);
 
   [[deprecated]]
@@ -188,6 +227,14 @@ class Person : public PersonIndexAllHandler, public PersonIndexByLocationStateAg
 
   void schedule_relapse_event(ClonalParasitePopulation *clinical_caused_parasite, const int &time_until_relapse);
 
+  /// duration of a clinical episode, until its EndClinicalEvent or EndClinicalByNoTreatmentEvent
+  static int draw_clinical_duration(Random &random);
+
+  /// whether a clinical episode that ends with parasites in blood relapses
+  static bool will_relapse(Config &config, Random &random);
+
+  static int draw_relapse_duration(Random &random, const int &time_until_relapse);
+
   void schedule_move_parasite_to_blood(Genotype *genotype, const int &time);
 
   void schedule_mature_gametocyte_event(ClonalParasitePopulation *clinical_caused_parasite);
@@ -222,7 +269,6 @@ class Person : public PersonIndexAllHandler, public PersonIndexByLocationStateAg
 
   void move_to_population(Population *target_population);
 
-  bool has_birthday_event() const;
 
   bool has_update_by_having_drug_event() const;
 
@@ -232,6 +278,18 @@ class Person : public PersonIndexAllHandler, public PersonIndexByLocationStateAg
 
   double p_infection_from_an_infectious_bite() const;
 
+  static double p_infection_from_an_infectious_bite(const double &immune_value);
+
+  /**
+   * Hybrid compartmental mode: an uninfected person without drug in blood only ages and loses immunity, it can be
+   * held in a compartment instead of being updated. With age dependent biting levels, persons under 20 are excluded
+   * since their biting level still changes with age.
+   */
+  bool can_join_compartment() const;
+
+  /// brings a person held in a compartment back to individual updates before an individual event changes its state
+  void leave_compartment();
+
   bool isGametocytaemic() const;
 
   void generate_prob_present_at_mda_by_age();
@@ -0,0 +1,432 @@
+//
+// PkPdCohort.cpp
+//
+
+#include "PkPdCohort.h"
+#include <algorithm>
+#include <cmath>
+#include "Constants.h"
+#include "Core/Config/Config.h"
+#include "Core/Random.h"
+#include "Helpers/TimeHelpers.h"
+#include "ClonalParasitePopulation.h"
+#include "DrugsInBlood.h"
+#include "ImmuneSystem.h"
+#include "InfantImmuneComponent.h"
+#include "NonInfantImmuneComponent.h"
+#include "Events/ProgressToClinicalEvent.h"
+#include "Events/Population/TurnOffMutationEvent.h"
+#include "Parasites/Genotype.h"
+#include "Therapies/DrugDatabase.h"
+#include "Therapies/DrugType.h"
+#include "Therapies/SCTherapy.h"
+#include "easylogging++.h"
+
+PkPdCohort::PkPdCohort(Config *config, Random *random) : config_(config), random_(random) {}
+
+PkPdCohort::~PkPdCohort() = default;
+
+std::size_t PkPdCohort::size() const {
+  return hosts_.size();
+}
+
+double PkPdCohort::get_efficacy(Genotype *genotype, SCTherapy *therapy) {
+  LOG_IF(genotype == nullptr || therapy == nullptr, FATAL) << "PkPdCohort needs a genotype and an SCTherapy";
+  genotype_ = genotype;
+  therapy_ = therapy;
+  log10_daily_fitness_ = log10(genotype_->daily_fitness_multiple_infection());
+  const auto &ims = config_->immune_system_information();
+  parasite_density_can_increase_ = log10(std::max(ims.c_max, ims.c_min)) + log10_daily_fitness_ > 0;
+
+  // the config may change between cohorts
+  check_config();
+  calendar_.initialize(date::sys_days{config_->starting_date()}, config_->total_time() + 1);
+  initialize_hosts();
+
+  // as DxGGenerator: a blood infection from the liver that progresses to clinical on day 1
+  for (auto &host : hosts_) {
+    host.has_parasite = true;
+    host.log10_parasite_density = config_->parasite_density_level().log_parasite_density_from_liver;
+    host.update_function = NO_UPDATE;
+    host.immune_increase = true;
+    host.host_state = Person::EXPOSED;
+    schedule_event(host, PROGRESS_TO_CLINICAL_EVENT, 1);
+  }
+
+  for (auto &host : hosts_) {
+    for (auto time = 0; time <= config_->total_time() && !is_settled(host); time++) {
+      if (time == host.next_update_time) {
+        // UpdateEveryKDaysEvent
+        update(host, time);
+        host.next_update_time += config_->update_frequency();
+      }
+      // the events may schedule new events, which may be today
+      auto has_executed_events = false;
+      for (auto i = 0ul; i < host.events.size() && host.host_state != Person::DEAD; i++) {
+        const auto event = host.events[i];
+        if (event.time == time && event.executable) {
+          host.events[i].executable = false;
+          has_executed_events = true;
+          execute(host, event, time);
+        }
+      }
+      if (has_executed_events) {
+        host.events.erase(std::remove_if(host.events.begin(), host.events.end(),
+                                         [](const HostEvent &event) { return !event.executable; }),
+                          host.events.end());
+      }
+    }
+  }
+
+  // ModelDataCollector::perform_population_statistic
+  auto number_of_living_hosts = 0;
+  auto number_of_positive_hosts = 0;
+  for (const auto &host : hosts_) {
+    if (host.host_state == Person::DEAD) {
+      continue;
+    }
+    number_of_living_hosts++;
+    if (host.host_state == Person::CLINICAL
+        || (host.host_state == Person::ASYMPTOMATIC && host.has_parasite
+            && host.log10_parasite_density >= config_->parasite_density_level().log_parasite_density_detectable_pfpr)) {
+      number_of_positive_hosts++;
+    }
+  }
+  return number_of_living_hosts == 0 ? 0 : 1 - number_of_positive_hosts / static_cast<double>(number_of_living_hosts);
+}
+
+void PkPdCohort::check_config() {
+  LOG_IF(config_->birth_rate() > 0, WARNING) << "PkPdCohort does not simulate births";
+  LOG_IF(std::any_of(config_->death_rate_by_age_class().begin(), config_->death_rate_by_age_class().end(),
+                     [](const double &death_rate) { return death_rate > 0; }), WARNING)
+    << "PkPdCohort does not simulate background deaths";
+
+  auto is_mutation_turned_off = false;
+  for (auto *event : config_->preconfig_population_events()) {
+    is_mutation_turned_off |= dynamic_cast<TurnOffMutationEvent *>(event) != nullptr && event->time <= 0;
+  }
+  auto has_mutations = false;
+  for (auto &drug_type : *config_->drug_db()) {
+    has_mutations |= drug_type.second->p_mutation() > 0;
+  }
+  LOG_IF(has_mutations && !is_mutation_turned_off, WARNING)
+    << "PkPdCohort does not simulate mutations, add a turn_off_mutation event on the starting date";
+}
+
+void PkPdCohort::initialize_hosts() {
+  const auto &ims = config_->immune_system_information();
+  // the hosts are reused from a cohort to the next, their event lists keep their capacity
+  auto number_of_hosts = 0ul;
+  for (auto loc = 0ul; loc < config_->location_db().size(); loc++) {
+    const auto &location = config_->location_db()[loc];
+    const auto popsize_by_location = static_cast<int>(location.population_size *
+        config_->artificial_rescaling_of_population_size());
+    auto temp_sum = 0;
+    for (auto age_class = 0ul; age_class < config_->initial_age_structure().size(); age_class++) {
+      auto number_of_individual_by_loc_ageclass = 0;
+      if (age_class == config_->initial_age_structure().size() - 1) {
+        number_of_individual_by_loc_ageclass = popsize_by_location - temp_sum;
+      } else {
+        number_of_individual_by_loc_ageclass = static_cast<int>(popsize_by_location *
+            location.age_distribution[age_class]);
+        temp_sum += number_of_individual_by_loc_ageclass;
+      }
+
+      const auto age_from = (age_class == 0) ? 0 : config_->initial_age_structure()[age_class - 1];
+      const auto age_to = config_->initial_age_structure()[age_class];
+      for (auto i = 0; i < number_of_individual_by_loc_ageclass; i++) {
+        if (number_of_hosts == hosts_.size()) {
+          hosts_.emplace_back();
+        }
+        auto &host = hosts_[number_of_hosts++];
+        host.events.clear();
+        host.location = static_cast<int>(loc);
+        host.host_state = Person::SUSCEPTIBLE;
+        const auto age = static_cast<int>(random_->random_uniform_int(age_from, age_to + 1));
+
+        // Person::set_next_birthday
+        const int days_to_next_birthday = random_->random_uniform(Constants::DAYS_IN_YEAR());
+        const auto next_birthday = calendar_.day_of(
+            date::sys_days{config_->starting_date()} + date::days{days_to_next_birthday});
+        host.birth_year = next_birthday.year - (age + 1);
+        host.birth_month_day = next_birthday.month_day();
+
+        const auto simulation_time_birthday = TimeHelpers::get_simulation_time_birthday(
+            days_to_next_birthday, age, date::sys_days{config_->starting_date()});
+        host.is_infant = simulation_time_birthday + Constants::DAYS_IN_YEAR() / 2 >= 0;
+        if (host.is_infant) {
+          schedule_event(host, SWITCH_IMMUNE_COMPONENT_EVENT,
+                         simulation_time_birthday + Constants::DAYS_IN_YEAR() / 2);
+        }
+        host.immune_value = random_->random_beta(ims.alpha_immune, ims.beta_immune);
+        host.immune_increase = false;
+
+        host.latest_update_time = 0;
+        host.next_update_time = static_cast<int>(random_->random_uniform(config_->update_frequency())) + 1;
+        host.has_parasite = false;
+        host.update_function = NO_UPDATE;
+        host.drugs.clear();
+      }
+    }
+  }
+  hosts_.resize(number_of_hosts);
+}
+
+bool PkPdCohort::is_settled(const Host &host) const {
+  if (host.host_state == Person::DEAD || !host.has_parasite) {
+    // a cured host stays susceptible, there are no new infections
+    return true;
+  }
+  if (host.host_state == Person::CLINICAL || host.update_function == NO_UPDATE
+      || host.update_function == PROGRESS_TO_CLINICAL || parasite_density_can_increase_
+      || host.log10_parasite_density >= config_->parasite_density_level().log_parasite_density_detectable_pfpr) {
+    return false;
+  }
+  // the density of an asymptomatic host below the detection level only decreases, unless it progresses to clinical
+  for (const auto &event : host.events) {
+    if (event.type == PROGRESS_TO_CLINICAL_EVENT || event.type == END_CLINICAL_BY_NO_TREATMENT_EVENT
+        || (config_->p_relapse() > 0 && event.type != SWITCH_IMMUNE_COMPONENT_EVENT)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int PkPdCohort::age(const Host &host, const int &time) const {
+  return Person::age_on(calendar_[time], host.birth_year, host.birth_month_day);
+}
+
+void PkPdCohort::update(Host &host, const int &time) {
+  if (host.latest_update_time == time) return;
+  const auto duration = time - host.latest_update_time;
+  const auto &ims = config_->immune_system_information();
+
+  // ClonalParasitePopulation::update with the immune value of the last update
+  if (host.has_parasite) {
+    if (host.update_function == PROGRESS_TO_CLINICAL) {
+      host.log10_parasite_density = config_->parasite_density_level().log_parasite_density_asymptomatic;
+    } else if (host.update_function != NO_UPDATE) {
+      host.log10_parasite_density = ImmuneSystem::get_parasite_size_after_t_days(
+          ims, host.immune_value, duration, host.log10_parasite_density, genotype_->daily_fitness_multiple_infection());
+    }
+  }
+
+  for (auto &drug : host.drugs) {
+    drug.update(time, *config_, *random_);
+  }
+
+  update_by_drugs(host);
+
+  // ImmuneComponent::get_current_value
+  if (host.is_infant) {
+    host.immune_value = InfantImmuneComponent::get_value_after_t_days(*config_, host.immune_value, duration);
+  } else {
+    host.immune_value = ImmuneComponent::get_value_after_t_days(
+        *config_, host.immune_value, host.immune_increase,
+        NonInfantImmuneComponent::acquire_rate_by_age(*config_, age(host, time)), ims.decay_rate, duration);
+  }
+
+  // Person::update_current_state
+  host.drugs.erase(std::remove_if(host.drugs.begin(), host.drugs.end(),
+                                  [](const Drug &drug) { return drug.is_cut_off(); }),
+                   host.drugs.end());
+
+  if (host.has_parasite
+      && host.log10_parasite_density <= config_->parasite_density_level().log_parasite_density_cured + 0.00001) {
+    host.has_parasite = false;
+  }
+  if (!host.has_parasite) {
+    change_state_when_no_parasite_in_blood(host);
+  } else {
+    host.immune_increase = true;
+  }
+
+  host.latest_update_time = time;
+}
+
+void PkPdCohort::update_by_drugs(Host &host) {
+  // SingleHostClonalParasitePopulations::update_by_drugs for one clone and without mutations
+  if (!host.has_parasite || host.drugs.empty()) {
+    return;
+  }
+  const auto number_of_drugs = host.drugs.size();
+  genotype_ids_.resize(number_of_drugs);
+  drug_ids_.resize(number_of_drugs);
+  concentration_power_n_.resize(number_of_drugs);
+  maximum_killing_rates_.resize(number_of_drugs);
+  killing_rates_.resize(number_of_drugs);
+  for (auto d = 0ul; d < number_of_drugs; d++) {
+    const auto &drug = host.drugs[d];
+    auto *drug_type = config_->drug_db()->at(drug.drug_type_id());
+    genotype_ids_[d] = genotype_->genotype_id();
+    drug_ids_[d] = drug.drug_type_id();
+    concentration_power_n_[d] = drug_type->get_concentration_power_n(drug.last_update_value(*config_));
+    maximum_killing_rates_[d] = drug_type->maximum_parasite_killing_rate();
+  }
+  DrugType::get_parasite_killing_rates(config_->EC50_power_n_table(), genotype_ids_.data(), 1, drug_ids_.data(),
+                                       concentration_power_n_.data(), maximum_killing_rates_.data(), number_of_drugs,
+                                       killing_rates_.data());
+
+  const auto percent_parasite_remove = DrugType::get_percent_parasite_remove(killing_rates_.data(), number_of_drugs);
+  if (percent_parasite_remove > 0) {
+    host.log10_parasite_density = ClonalParasitePopulation::get_parasite_density_after_drug_action(
+        config_->parasite_density_level(), host.log10_parasite_density, percent_parasite_remove);
+  }
+}
+
+void PkPdCohort::execute(Host &host, const HostEvent &event, const int &time) {
+  // Event::perform_execute
+  update(host, time);
+
+  switch (event.type) {
+    case PROGRESS_TO_CLINICAL_EVENT:progress_to_clinical(host, time);
+      break;
+    case END_CLINICAL_BY_NO_TREATMENT_EVENT:
+    case END_CLINICAL_EVENT:
+      if (!host.has_parasite) {
+        change_state_when_no_parasite_in_blood(host);
+      } else {
+        //still have parasite in blood
+        host.immune_increase = true;
+        host.host_state = Person::ASYMPTOMATIC;
+        if (event.type == END_CLINICAL_BY_NO_TREATMENT_EVENT) {
+          host.log10_parasite_density = config_->parasite_density_level().log_parasite_density_asymptomatic;
+        }
+        determine_relapse_or_not(host, time);
+      }
+      break;
+    case UPDATE_WHEN_DRUG_IS_PRESENT_EVENT:
+      if (!host.drugs.empty()) {
+        if (host.has_parasite && host.host_state == Person::CLINICAL
+            && host.log10_parasite_density <= config_->parasite_density_level().log_parasite_density_asymptomatic) {
+          host.host_state = Person::ASYMPTOMATIC;
+        }
+        schedule_event(host, UPDATE_WHEN_DRUG_IS_PRESENT_EVENT, time + 1);
+      } else if (host.has_parasite && host.update_function == HAVING_DRUG) {
+        determine_relapse_or_not(host, time);
+      }
+      break;
+    case SWITCH_IMMUNE_COMPONENT_EVENT:
+      // a new NonInfantImmuneComponent starts from 0
+      host.is_infant = false;
+      host.immune_value = 0.0;
+      break;
+  }
+}
+
+void PkPdCohort::progress_to_clinical(Host &host, const int &time) {
+  if (!host.has_parasite) {
+    //parasites might be cleaned by immune system or other things else
+    return;
+  }
+
+  if (host.host_state == Person::CLINICAL) {
+    host.update_function = IMMUNITY_CLEARANCE;
+    return;
+  }
+
+  host.log10_parasite_density = ProgressToClinicalEvent::draw_clinical_log10_parasite_density(*config_, *random_);
+  host.host_state = Person::CLINICAL;
+
+  // cancel all other progress to clinical events
+  for (auto &event : host.events) {
+    if (event.type == PROGRESS_TO_CLINICAL_EVENT) {
+      event.executable = false;
+    }
+  }
+  host.update_function = CLINICAL;
+
+  const auto current_age = age(host, time);
+  const auto ac = Person::age_class_of(*config_, current_age);
+  const auto p = random_->random_flat(0.0, 1.0);
+  const auto &location = config_->location_db()[host.location];
+  const auto p_treatment = current_age <= 5 ? location.p_treatment_less_than_5 : location.p_treatment_more_than_5;
+
+  if (p <= p_treatment) {
+    receive_therapy(host, time);
+    host.update_function = HAVING_DRUG;
+
+    if (Person::will_progress_to_death_when_recieve_treatment(*config_, *random_, ac)) {
+      host.host_state = Person::DEAD;
+      host.events.clear();
+      return;
+    }
+
+    schedule_event(host, UPDATE_WHEN_DRUG_IS_PRESENT_EVENT, time + 1);
+    schedule_event(host, END_CLINICAL_EVENT, time + Person::draw_clinical_duration(*random_));
+  } else {
+    if (Person::will_progress_to_death_when_receive_no_treatment(*config_, *random_, ac)) {
+      host.host_state = Person::DEAD;
+      host.events.clear();
+      return;
+    }
+    schedule_event(host, END_CLINICAL_BY_NO_TREATMENT_EVENT, time + Person::draw_clinical_duration(*random_));
+  }
+}
+
+void PkPdCohort::receive_therapy(Host &host, const int &time) {
+  for (auto j = 0ul; j < therapy_->drug_ids.size(); ++j) {
+    const auto drug_id = therapy_->drug_ids[j];
+    const auto dosing_days = therapy_->drug_ids.size() == therapy_->dosing_day.size() ? therapy_->dosing_day[j]
+                                                                                      : therapy_->dosing_day[0];
+    add_drug_to_blood(host, drug_id, Person::complied_dosing_days(*config_, *random_, dosing_days), time);
+  }
+}
+
+void PkPdCohort::add_drug_to_blood(Host &host, const int &drug_id, const int &dosing_days, const int &time) {
+  auto *drug_type = config_->drug_db()->at(drug_id);
+  const auto drug_level = Person::draw_drug_level(drug_type, *random_, Person::age_class_of(*config_, age(host, time)));
+
+  Drug drug(drug_type);
+  drug.set_dosing_days(dosing_days);
+  drug.set_last_update_time(time);
+  drug.set_last_update_value(drug_level);
+  drug.set_starting_value(drug_level);
+  drug.set_start_time(time);
+  drug.set_end_time(time + drug_type->get_total_duration_of_drug_activity(dosing_days));
+
+  auto index = 0ul;
+  while (index < host.drugs.size() && host.drugs[index].drug_type_id() < drug_id) {
+    index++;
+  }
+  if (index < host.drugs.size() && host.drugs[index].drug_type_id() == drug_id) {
+    // DrugsInBlood::add_drug keeps the starting value of a drug already in blood
+    auto &current = host.drugs[index];
+    current.set_dosing_days(drug.dosing_days());
+    current.set_last_update_value(drug.last_update_value(*config_));
+    current.set_last_update_time(drug.last_update_time());
+    current.set_start_time(drug.start_time());
+    current.set_end_time(drug.end_time());
+    return;
+  }
+
+  host.drugs.insert(host.drugs.begin() + index, drug);
+}
+
+void PkPdCohort::determine_relapse_or_not(Host &host, const int &time) {
+  if (!host.has_parasite) {
+    return;
+  }
+  if (Person::will_relapse(*config_, *random_)) {
+    //progress to clinical after several days
+    host.update_function = PROGRESS_TO_CLINICAL;
+    host.log10_parasite_density = config_->parasite_density_level().log_parasite_density_asymptomatic;
+    schedule_event(host, PROGRESS_TO_CLINICAL_EVENT,
+                   time + Person::draw_relapse_duration(*random_, config_->relapse_duration()));
+  } else {
+    //progress to clearance
+    host.log10_parasite_density = std::min(host.log10_parasite_density,
+                                           config_->parasite_density_level().log_parasite_density_asymptomatic);
+    host.update_function = IMMUNITY_CLEARANCE;
+  }
+}
+
+void PkPdCohort::change_state_when_no_parasite_in_blood(Host &host) {
+  // there is no parasite in the liver
+  host.host_state = Person::SUSCEPTIBLE;
+  host.immune_increase = false;
+}
+
+void PkPdCohort::schedule_event(Host &host, const EventType &type, const int &time) {
+  host.events.push_back(HostEvent{time, type, true});
+}
@@ -0,0 +1,147 @@
+//
+// PkPdCohort.h
+//
+
+#ifndef PKPDCOHORT_H
+#define PKPDCOHORT_H
+
+#include <vector>
+#include "Core/PropertyMacro.h"
+#include "Core/SimulationCalendar.h"
+#include "Person.h"
+#include "Therapies/Drug.h"
+
+class Config;
+
+class Random;
+
+class Genotype;
+
+class SCTherapy;
+
+/**
+ * Within-host PK/PD cohort for the efficacy of a therapy against a genotype, as measured by DxGGenerator: every host
+ * gets a blood infection of the genotype that progresses to clinical on day 1 and is treated as in
+ * ProgressToClinicalEvent, the efficacy is 1 - the blood slide prevalence of the living hosts after total_time days.
+ *
+ * Only the immune value, the parasite density, the drugs in blood and the events of the clinical episode
+ * (EndClinicalEvent, EndClinicalByNoTreatmentEvent, UpdateWhenDrugIsPresentEvent, relapses and the switch of the
+ * infant immune component) are simulated, on a flat array of hosts that only uses the config and the random generator
+ * it is given (no scheduler, population, reporters or data collector). The formulas and draws are the ones of Drug,
+ * ImmuneComponent, ImmuneSystem, Person and ProgressToClinicalEvent, called with that config and random generator. The
+ * hosts are drawn as in Population::initialize. The probability of treatment is the one of the location in the config,
+ * as with the initial treatment coverage model.
+ *
+ * There are no births, background deaths, new infections or mutations. get_efficacy warns when the config has births,
+ * background deaths or mutations without a turn_off_mutation event on the first day. Background deaths are independent
+ * of the infection, so the efficacy only lacks their sampling noise; births and mutations change it. A host is
+ * simulated until its blood slide status at the end of the simulation is known, most hosts are cured or settle below
+ * the detection level within days of the treatment.
+ */
+class PkPdCohort {
+ DISALLOW_COPY_AND_ASSIGN(PkPdCohort)
+
+ public:
+  PkPdCohort(Config *config, Random *random);
+
+  virtual ~PkPdCohort();
+
+  /// draws a new cohort, infects and treats it, and returns the fraction of the living hosts that are not positive
+  double get_efficacy(Genotype *genotype, SCTherapy *therapy);
+
+  /// number of hosts of the last cohort
+  std::size_t size() const;
+
+ private:
+  // the update functions of ClonalParasitePopulation, CLINICAL, HAVING_DRUG and IMMUNITY_CLEARANCE share the arithmetic
+  enum UpdateFunction {
+    NO_UPDATE = 0,
+    PROGRESS_TO_CLINICAL,
+    CLINICAL,
+    HAVING_DRUG,
+    IMMUNITY_CLEARANCE
+  };
+
+  enum EventType {
+    PROGRESS_TO_CLINICAL_EVENT = 0,
+    END_CLINICAL_EVENT,
+    END_CLINICAL_BY_NO_TREATMENT_EVENT,
+    UPDATE_WHEN_DRUG_IS_PRESENT_EVENT,
+    SWITCH_IMMUNE_COMPONENT_EVENT
+  };
+
+  struct HostEvent {
+    int time;
+    EventType type;
+    bool executable;
+  };
+
+  struct Host {
+    int location;
+    // the age is derived from the birth date, as in Person::age
+    int birth_year;
+    int birth_month_day;
+    Person::HostStates host_state;
+    bool is_infant;
+    double immune_value;
+    bool immune_increase;
+    int latest_update_time;
+    int next_update_time;
+    // a single clone, there are no new infections
+    bool has_parasite;
+    double log10_parasite_density;
+    UpdateFunction update_function;
+    // sorted by drug id as in DrugsInBlood, the hosts keep their capacity from a cohort to the next
+    std::vector<Drug> drugs;
+    // in the order they are scheduled, as in the daily event lists of the scheduler
+    std::vector<HostEvent> events;
+  };
+
+  /// logs the differences between the config and the cohort, see the class comment
+  void check_config();
+
+  void initialize_hosts();
+
+  /// true when the blood slide status of the host at the end of the simulation is known
+  bool is_settled(const Host &host) const;
+
+  int age(const Host &host, const int &time) const;
+
+  /// Person::update
+  void update(Host &host, const int &time);
+
+  void update_by_drugs(Host &host);
+
+  void execute(Host &host, const HostEvent &event, const int &time);
+
+  /// ProgressToClinicalEvent::execute
+  void progress_to_clinical(Host &host, const int &time);
+
+  void receive_therapy(Host &host, const int &time);
+
+  /// Person::add_drug_to_blood and DrugsInBlood::add_drug
+  void add_drug_to_blood(Host &host, const int &drug_id, const int &dosing_days, const int &time);
+
+  void determine_relapse_or_not(Host &host, const int &time);
+
+  void change_state_when_no_parasite_in_blood(Host &host);
+
+  void schedule_event(Host &host, const EventType &type, const int &time);
+
+  Config *config_;
+  Random *random_;
+  Genotype *genotype_{nullptr};
+  SCTherapy *therapy_{nullptr};
+  std::vector<Host> hosts_;
+  // per drug buffers of update_by_drugs
+  IntVector genotype_ids_;
+  IntVector drug_ids_;
+  DoubleVector concentration_power_n_;
+  DoubleVector maximum_killing_rates_;
+  DoubleVector killing_rates_;
+  SimulationCalendar calendar_;
+  double log10_daily_fitness_{0};
+  bool parasite_density_can_increase_{false};
+};
+
+#endif // PKPDCOHORT_H
@@ -16,16 +16,21 @@
 #include "NonInfantImmuneComponent.h"
 #include "ImmuneSystem.h"
 #include "Events/SwitchImmuneComponentEvent.h"
-#include "Events/BirthdayEvent.h"
+#include "Events/InfectionEvent.h"
+#include "Events/Population/BirthEvent.h"
+#include "Events/Population/DeathEvent.h"
 #include "Properties/PersonIndexByLocationBittingLevel.h"
 #include "Core/Random.h"
 #include "Properties/PersonIndexByLocationMovingLevel.h"
+#include "Properties/PersonIndexByAgeClassTransition.h"
+#include "Properties/PersonIndexByCompartment.h"
 #include "MDC/ModelDataCollector.h"
 #include "SingleHostClonalParasitePopulations.h"
 #include "Helpers/TimeHelpers.h"
 #include "easylogging++.h"
 #include "Helpers/ObjectHelpers.h"
 #include "Spatial/SpatialModel.h"
+#include <algorithm>
 #include <cmath>
 #include <cfloat>
 
@@ -152,10 +157,13 @@ std::size_t Population::size_residents_only(const int &location) {
   return temp;
 }
 
-void Population::perform_infection_event() {
+void Population::perform_infection_event(const int &number_of_days) {
   //    std::cout << "Infection Event" << std::endl;
 
   PersonPtrVector today_infections;
+  const auto day_of_year = Model::SCHEDULER->current_day_in_year();
+  // hybrid compartmental mode only
+  auto* compartments = get_person_index<PersonIndexByCompartment>();
   for (auto loc = 0; loc < Model::CONFIG->number_of_locations(); loc++) {
     for (auto parasite_type_id = 0;
          parasite_type_id < Model::CONFIG->number_of_parasite_types(); parasite_type_id++) {
@@ -164,10 +172,10 @@ void Population::perform_infection_event() {
       if (force_of_infection <= DBL_EPSILON)
         continue;
 
-      const auto new_beta = Model::CONFIG->location_db()[loc].beta*Model::MODEL->get_seasonal_factor(
-          Model::SCHEDULER->calendar_date, loc);
+      const auto new_beta = Model::CONFIG->location_db()[loc].beta*
+          Model::CONFIG->seasonal_info().get_factor(loc, day_of_year);
 
-      auto poisson_means = new_beta*force_of_infection;
+      auto poisson_means = new_beta*force_of_infection*number_of_days;
 
       auto number_of_bites = Model::RANDOM->random_poisson(poisson_means);
       if (number_of_bites <= 0)
@@ -182,47 +190,42 @@ void Population::perform_infection_event() {
       //                Report::TotalNumberOfBitesByYear += numberOfInfections;
       //            }
 
-      DoubleVector vLevelDensity;
       auto pi = get_person_index<PersonIndexByLocationBittingLevel>();
 
+      auto &v_level_density = biting_level_sampler_.weights(
+          Model::CONFIG->relative_bitting_info().number_of_biting_levels);
       for (auto i = 0; i < Model::CONFIG->relative_bitting_info().number_of_biting_levels; i++) {
-        auto temp = Model::CONFIG->relative_bitting_info().v_biting_level_value[i]*
+        v_level_density[i] = Model::CONFIG->relative_bitting_info().v_biting_level_value[i]*
             pi->vPerson()[loc][i].size();
-        vLevelDensity.push_back(temp);
       }
 
-      std::vector<unsigned int> v_int_number_of_bites(vLevelDensity.size());
-      model_->random()->random_multinomial(vLevelDensity.size(), number_of_bites, &vLevelDensity[0],
-                                           &v_int_number_of_bites[0]);
+      const auto &v_int_number_of_bites = biting_level_sampler_.sample(model_->random(), number_of_bites);
 
       for (auto bitting_level = 0; bitting_level < v_int_number_of_bites.size(); bitting_level++) {
         const auto size = pi->vPerson()[loc][bitting_level].size();
         if (size==0) continue;
-        for (auto j = 0u; j < v_int_number_of_bites[bitting_level]; j++) {
-          //select 1 random person from level i
-          const auto index = model_->random()->random_uniform(size);
-          auto* person = pi->vPerson()[loc][bitting_level][index];
-
-          assert(person->host_state()!=Person::DEAD);
-          person->increase_number_of_times_bitten();
-
-          const auto p_infectious = Model::RANDOM->random_flat(0.0, 1.0);
-          //only infect with real infectious bite
-          if (Model::CONFIG->using_variable_probability_infectious_bites_cause_infection()) {
-            if (p_infectious <= person->p_infection_from_an_infectious_bite()) {
-              if (person->host_state()!=Person::EXPOSED && person->liver_parasite_type()==nullptr) {
-                person->today_infections()->push_back(parasite_type_id);
-                today_infections.push_back(person);
-              }
-            }
-          } else if (p_infectious <= Model::CONFIG->p_infection_from_an_infectious_bite()) {
-            if (person->host_state()!=Person::EXPOSED && person->liver_parasite_type()==nullptr) {
-              person->today_infections()->push_back(parasite_type_id);
-              today_infections.push_back(person);
-            }
+        if (compartments==nullptr) {
+          for (auto j = 0u; j < v_int_number_of_bites[bitting_level]; j++) {
+            //select 1 random person from level i
+            const auto index = model_->random()->random_uniform(size);
+            perform_infectious_bite(pi->vPerson()[loc][bitting_level][index], parasite_type_id, number_of_days,
+                                    today_infections);
           }
+          continue;
+        }
 
+        // the bites are shared between the persons simulated individually and the compartment of the level
+        const auto &individuals = compartments->vPerson()[loc][bitting_level];
+        const auto &compartment = compartments->compartments()[loc][bitting_level];
+        const auto number_of_bites_on_compartment = compartment.empty() ? 0u : static_cast<unsigned int>(
+            Model::RANDOM->random_binomial(compartment.size()/static_cast<double>(size),
+                                           v_int_number_of_bites[bitting_level]));
+        for (auto j = number_of_bites_on_compartment; j < v_int_number_of_bites[bitting_level]; j++) {
+          const auto index = model_->random()->random_uniform(individuals.size());
+          perform_infectious_bite(individuals[index], parasite_type_id, number_of_days, today_infections);
         }
+        perform_infectious_bites_on_compartment(compartment, parasite_type_id, number_of_bites_on_compartment,
+                                                today_infections);
       }
     }
   }
@@ -231,6 +234,15 @@ void Population::perform_infection_event() {
   if (today_infections.empty()) return;
 
   for (auto* p : today_infections) {
+    if (number_of_days > 1) {
+      // the infections of a tau leap are spread over the days of the leap
+      for (const auto parasite_type_id : *p->today_infections()) {
+        InfectionEvent::schedule_event(Model::SCHEDULER, p, parasite_type_id, Model::SCHEDULER->current_time() +
+            static_cast<int>(Model::RANDOM->random_uniform(number_of_days)));
+      }
+      p->today_infections()->clear();
+      continue;
+    }
     if (!p->today_infections()->empty()) {
       Model::DATA_COLLECTOR->monthly_number_of_new_infections_by_location()[p->location()] += 1;
     }
@@ -242,6 +254,55 @@ void Population::perform_infection_event() {
   //    std::cout << "End Infection Event" << std::endl;
 }
 
+void Population::perform_infectious_bite(Person* person, const int &parasite_type_id, const int &number_of_days,
+                                         PersonPtrVector &today_infections) const {
+  assert(person->host_state()!=Person::DEAD);
+  person->increase_number_of_times_bitten();
+
+  const auto p_infectious = Model::RANDOM->random_flat(0.0, 1.0);
+  const auto p_infection = Model::CONFIG->using_variable_probability_infectious_bites_cause_infection()
+                           ? person->p_infection_from_an_infectious_bite()
+                           : Model::CONFIG->p_infection_from_an_infectious_bite();
+  //only infect with real infectious bite, in a tau leap the liver is checked on the day of the infection
+  if (p_infectious <= p_infection && (number_of_days > 1 || (person->host_state()!=Person::EXPOSED
+      && person->liver_parasite_type()==nullptr))) {
+    person->today_infections()->push_back(parasite_type_id);
+    today_infections.push_back(person);
+  }
+}
+
+void Population::perform_infectious_bites_on_compartment(const PersonPtrVector &compartment,
+                                                         const int &parasite_type_id,
+                                                         const unsigned int &number_of_bites,
+                                                         PersonPtrVector &today_infections) const {
+  if (number_of_bites==0) return;
+
+  if (Model::DATA_COLLECTOR->metric_registry().is_required(MetricRegistry::PERCENTAGE_BITES_ON_TOP_20)) {
+    for (auto j = 0u; j < number_of_bites; j++) {
+      const auto index = model_->random()->random_uniform(compartment.size());
+      perform_infectious_bite(compartment[index], parasite_type_id, 1, today_infections);
+    }
+    return;
+  }
+
+  // persons in a compartment are uninfected, every bite that passes the draw causes an infection
+  const auto using_variable_probability =
+      Model::CONFIG->using_variable_probability_infectious_bites_cause_infection();
+  const auto max_p_infection = using_variable_probability ? Person::p_infection_from_an_infectious_bite(0.0)
+                                                          : Model::CONFIG->p_infection_from_an_infectious_bite();
+  const auto number_of_infections = Model::RANDOM->random_binomial(max_p_infection, number_of_bites);
+  for (auto j = 0; j < number_of_infections; j++) {
+    const auto index = model_->random()->random_uniform(compartment.size());
+    auto* person = compartment[index];
+    if (using_variable_probability &&
+        Model::RANDOM->random_flat(0.0, 1.0)*max_p_infection > person->p_infection_from_an_infectious_bite()) {
+      continue;
+    }
+    person->today_infections()->push_back(parasite_type_id);
+    today_infections.push_back(person);
+  }
+}
+
 void Population::initialize() {
 
   if (model()!=nullptr) {
@@ -311,7 +372,7 @@ void Population::initialize() {
           LOG_IF(simulation_time_birthday > 0, FATAL) <<
                                                       "simulation_time_birthday have to be <= 0 when initilizing population";
 
-          BirthdayEvent::schedule_event(Model::SCHEDULER, p, days_to_next_birthday);
+          p->set_next_birthday(days_to_next_birthday);
 
           //set immune component
           if (simulation_time_birthday + Constants::DAYS_IN_YEAR()/2 >= 0) {
@@ -389,18 +450,16 @@ void Population::introduce_parasite(const int &location, Genotype* parasite_type
 
   if (model_!=nullptr) {
 
-    DoubleVector vLevelDensity;
     auto pi = get_person_index<PersonIndexByLocationBittingLevel>();
 
+    auto &v_level_density = biting_level_sampler_.weights(
+        Model::CONFIG->relative_bitting_info().number_of_biting_levels);
     for (auto i = 0; i < Model::CONFIG->relative_bitting_info().number_of_biting_levels; i++) {
-      auto temp = Model::CONFIG->relative_bitting_info().v_biting_level_value[i]*
+      v_level_density[i] = Model::CONFIG->relative_bitting_info().v_biting_level_value[i]*
           pi->vPerson()[location][i].size();
-      vLevelDensity.push_back(temp);
     }
 
-    std::vector<unsigned int> vIntNumberOfBites(vLevelDensity.size());
-    model_->random()->random_multinomial(vLevelDensity.size(), num_of_infections, &vLevelDensity[0],
-                                         &vIntNumberOfBites[0]);
+    const auto &vIntNumberOfBites = biting_level_sampler_.sample(model_->random(), num_of_infections);
 
     for (auto biting_level = 0; biting_level < vIntNumberOfBites.size(); biting_level++) {
       const int size = pi->vPerson()[location][biting_level].size();
@@ -419,6 +478,7 @@ void Population::introduce_parasite(const int &location, Genotype* parasite_type
 }
 
 void Population::initial_infection(Person* person, Genotype* parasite_type) const {
+  person->leave_compartment();
 
   person->immune_system()->set_increase(true);
   person->set_host_state(Person::ASYMPTOMATIC);
@@ -474,13 +534,22 @@ void Population::update_force_of_infection(const int &current_time) {
 //
 // }
 
-void Population::perform_birth_event() {
+void Population::perform_birth_event(const int &number_of_days) {
   //    std::cout << "Birth Event" << std::endl;
 
   for (auto loc = 0; loc < Model::CONFIG->number_of_locations(); loc++) {
-    auto poisson_means = size(loc)*Model::CONFIG->birth_rate()/Constants::DAYS_IN_YEAR();
+    auto poisson_means = size(loc)*Model::CONFIG->birth_rate()*number_of_days/Constants::DAYS_IN_YEAR();
     const auto number_of_births = Model::RANDOM->random_poisson(poisson_means);
     for (auto i = 0; i < number_of_births; i++) {
+      if (number_of_days > 1) {
+        // the births of a tau leap or a quiescent period are spread over its days, the population events of today
+        // have already been executed
+        const auto day = static_cast<int>(Model::RANDOM->random_uniform(number_of_days));
+        if (day > 0) {
+          BirthEvent::schedule_event(Model::SCHEDULER, loc, Model::SCHEDULER->current_time() + day);
+          continue;
+        }
+      }
       give_1_birth(loc);
       Model::DATA_COLLECTOR->update_person_days_by_years(loc, Constants::DAYS_IN_YEAR() -
           Model::SCHEDULER->current_day_in_year());
@@ -514,10 +583,8 @@ void Population::give_1_birth(const int &location) {
   p->set_moving_level(Model::CONFIG->moving_level_generator().draw_random_level(Model::RANDOM));
 
   p->set_birthday(Model::SCHEDULER->current_time());
-  const auto number_of_days_to_next_birthday = TimeHelpers::
-  number_of_days_to_next_year(Model::SCHEDULER->calendar_date);
-  BirthdayEvent::schedule_event(Model::SCHEDULER, p,
-                                Model::SCHEDULER->current_time() + number_of_days_to_next_birthday);
+  // born today, which keeps Feb 29 (a next birthday a year from Feb 29 would fall on Mar 1)
+  p->set_birth_date(Model::SCHEDULER->today().year, Model::SCHEDULER->today().month_day());
 
   //schedule for switch
   SwitchImmuneComponentEvent::schedule_for_switch_immune_component_event(Model::SCHEDULER, p,
@@ -532,28 +599,44 @@ void Population::give_1_birth(const int &location) {
   add_person(p);
 }
 
-void Population::perform_death_event() {
+void Population::perform_death_event(const int &number_of_days) {
   //    std::cout << "Death Event" << std::endl;
   //simply change state to dead and release later
   auto pi = get_person_index<PersonIndexByLocationStateAgeClass>();
   if (pi==nullptr) return;
 
-  for (auto loc = 0; loc < Model::CONFIG->number_of_locations(); loc++) {
+  for (auto loc = 0; number_of_days > 0 && loc < Model::CONFIG->number_of_locations(); loc++) {
     for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
       if (hs==Person::DEAD) continue;
       for (auto ac = 0; ac < Model::CONFIG->number_of_age_classes(); ac++) {
         const int size = pi->vPerson()[loc][hs][ac].size();
         if (size==0) continue;
-        auto poisson_means = size*Model::CONFIG->death_rate_by_age_class()[ac]/Constants::DAYS_IN_YEAR();
+        auto poisson_means =
+            size*Model::CONFIG->death_rate_by_age_class()[ac]*number_of_days/Constants::DAYS_IN_YEAR();
 
         assert(Model::CONFIG->death_rate_by_age_class().size()==Model::CONFIG->number_of_age_classes());
-        const auto number_of_deaths = Model::RANDOM->random_poisson(poisson_means);
+        auto number_of_deaths = Model::RANDOM->random_poisson(poisson_means);
         if (number_of_deaths==0) continue;
 
+        // the deaths of a tau leap are many, they are drawn among the persons still alive
+        if (number_of_days > 1) {
+          number_of_deaths = std::min(number_of_deaths, size);
+        }
+        auto number_of_deaths_today = 0;
         //                std::cout << numberOfDeaths << std::endl;
         for (int i = 0; i < number_of_deaths; i++) {
+          if (number_of_days > 1) {
+            // the deaths of a tau leap or a quiescent period are spread over its days as the births, so that the
+            // persons live their remaining days (and keep being bitten and infected) as with daily deaths
+            const auto day = static_cast<int>(Model::RANDOM->random_uniform(number_of_days));
+            if (day > 0) {
+              DeathEvent::schedule_event(Model::SCHEDULER, loc, ac, Model::SCHEDULER->current_time() + day);
+              continue;
+            }
+          }
           //change state to Death;
-          const int index = Model::RANDOM->random_uniform(size);
+          const int index = Model::RANDOM->random_uniform(number_of_days > 1 ? size - number_of_deaths_today : size);
+          number_of_deaths_today++;
           //                    std::cout << index << "-" << pi->vPerson()[loc][hs][ac].size() << std::endl;
           auto* p = pi->vPerson()[loc][hs][ac][index];
           p->cancel_all_events_except(nullptr);
@@ -586,47 +669,44 @@ void Population::clear_all_dead_state_individual() {
   }
 }
 
-void Population::perform_circulation_event() {
+void Population::perform_circulation_event(const int &number_of_days) {
   //for each location
   // get number of circulations based on size * circulation_percent
   // distributes that number into others location based of other location size
   // for each number in that list select an individual, and schedule a movement event on next day
   PersonPtrVector today_circulations;
 
-  std::vector<int> v_number_of_residents_by_location(Model::CONFIG->number_of_locations(), 0);
-
-  for (auto location = 0; location < Model::CONFIG->number_of_locations(); location++) {
-    //        v_number_of_residents_by_location[target_location] = (size(target_location));
-    v_number_of_residents_by_location[location] = Model::DATA_COLLECTOR->popsize_residence_by_location()[location];
-    //        std::cout << v_original_pop_size_by_location[target_location] << std::endl;
-  }
+  // the residents are only recounted by the data collector, the movement kernels and destination samplers are
+  // recombined after that
+  Model::CONFIG->spatial_model()->update_residents(Model::DATA_COLLECTOR->popsize_residence_by_location(),
+                                                  Model::DATA_COLLECTOR->popsize_residence_by_location_version());
 
   for (int from_location = 0; from_location < Model::CONFIG->number_of_locations(); from_location++) {
-    auto poisson_means = size(from_location)*Model::CONFIG->circulation_info().circulation_percent;
+    auto poisson_means = size(from_location)*Model::CONFIG->circulation_info().circulation_percent*number_of_days;
     if (poisson_means==0)continue;
     const auto number_of_circulating_from_this_location = Model::RANDOM->random_poisson(poisson_means);
     if (number_of_circulating_from_this_location==0) continue;
 
-    DoubleVector v_relative_outmovement_to_destination(Model::CONFIG->number_of_locations(), 0);
-    v_relative_outmovement_to_destination = Model::CONFIG->spatial_model()->get_v_relative_out_movement_to_destination(
-        from_location, Model::CONFIG->number_of_locations(),
-        Model::CONFIG->spatial_distance_matrix()[from_location],
-        v_number_of_residents_by_location);
-
-    std::vector<unsigned int> v_num_leavers_to_destination(
-        static_cast<unsigned long long int>(Model::CONFIG->number_of_locations()));
-
-    Model::RANDOM->random_multinomial(static_cast<int>(v_relative_outmovement_to_destination.size()),
-                                      static_cast<unsigned int>(number_of_circulating_from_this_location),
-                                      &v_relative_outmovement_to_destination[0], &v_num_leavers_to_destination[0]);
-
-    for (int target_location = 0; target_location < Model::CONFIG->number_of_locations(); target_location++) {
-      //            std::cout << v_num_leavers_to_destination[target_location] << std::endl;
-      if (v_num_leavers_to_destination[target_location]==0) continue;
-      //            std::cout << Model::SCHEDULER->current_time() << "\t" << from_location << "\t" << target_location << "\t"
-      //                      << v_num_leavers_to_destination[target_location] << std::endl;
-      perform_circulation_for_1_location(from_location, target_location,
-                                         v_num_leavers_to_destination[target_location],
+    if (Model::CONFIG->using_sparse_movement()) {
+      perform_sparse_circulation_from_1_location(from_location, number_of_circulating_from_this_location,
+                                                 today_circulations);
+      continue;
+    }
+
+    const auto &distances = Model::CONFIG->spatial_distance_matrix().row(from_location);
+    const auto* v_relative_outmovement_to_destination =
+        Model::CONFIG->spatial_model()->get_v_relative_out_movement_to_destination(
+            from_location, Model::CONFIG->spatial_distance_matrix());
+
+    // one entry per destination of the distance row (every location unless a distance cutoff is used)
+    const auto &v_num_leavers_to_destination = destination_sampler_.sample(
+        Model::RANDOM, v_relative_outmovement_to_destination, distances.size(),
+        static_cast<unsigned int>(number_of_circulating_from_this_location));
+
+    for (auto i = 0ul; i < distances.size(); i++) {
+      if (v_num_leavers_to_destination[i]==0) continue;
+      perform_circulation_for_1_location(from_location, distances.location(i),
+                                         v_num_leavers_to_destination[i],
                                          today_circulations);
 
     }
@@ -641,23 +721,42 @@ void Population::perform_circulation_event() {
 
 }
 
+void Population::perform_sparse_circulation_from_1_location(const int &from_location, const int &number_of_leavers,
+                                                            std::vector<Person*> &today_circulations) {
+  const auto &sampler = Model::CONFIG->spatial_model()->get_destination_sampler(
+      from_location, Model::CONFIG->spatial_distance_matrix(), Model::CONFIG->sparse_movement_min_relative_weight());
+  if (sampler.table.empty()) return;
+
+  leavers_by_destination_.resize(Model::CONFIG->number_of_locations(), 0);
+  drawn_destinations_.clear();
+  for (auto i = 0; i < number_of_leavers; i++) {
+    const auto target_location = sampler.locations[sampler.table.sample(Model::RANDOM)];
+    if (leavers_by_destination_[target_location]==0) {
+      drawn_destinations_.push_back(target_location);
+    }
+    leavers_by_destination_[target_location]++;
+  }
+
+  for (auto target_location : drawn_destinations_) {
+    perform_circulation_for_1_location(from_location, target_location, leavers_by_destination_[target_location],
+                                       today_circulations);
+    leavers_by_destination_[target_location] = 0;
+  }
+}
+
 void Population::perform_circulation_for_1_location(const int &from_location, const int &target_location,
                                                     const int &number_of_circulation,
                                                     std::vector<Person*> &today_circulations) {
-  DoubleVector vLevelDensity;
   auto pi = get_person_index<PersonIndexByLocationMovingLevel>();
 
+  auto &v_level_density = moving_level_sampler_.weights(Model::CONFIG->circulation_info().number_of_moving_levels);
   for (int i = 0; i < Model::CONFIG->circulation_info().number_of_moving_levels; i++) {
-    double temp = Model::CONFIG->circulation_info().v_moving_level_value[i]*
+    v_level_density[i] = Model::CONFIG->circulation_info().v_moving_level_value[i]*
         pi->vPerson()[from_location][i].size();
-    vLevelDensity.push_back(temp);
   }
 
-  std::vector<unsigned int> vIntNumberOfCirculation(vLevelDensity.size());
-
-  model_->random()->random_multinomial(static_cast<int>(vLevelDensity.size()),
-                                       static_cast<unsigned int>(number_of_circulation), &vLevelDensity[0],
-                                       &vIntNumberOfCirculation[0]);
+  const auto &vIntNumberOfCirculation = moving_level_sampler_.sample(model_->random(),
+                                                                     static_cast<unsigned int>(number_of_circulation));
 
   for (int moving_level = 0; moving_level < vIntNumberOfCirculation.size(); moving_level++) {
     auto size = static_cast<int>(pi->vPerson()[from_location][moving_level].size());
@@ -710,6 +809,27 @@ void Population::initialize_person_indices() {
       number_of_location, Model::CONFIG->circulation_info().number_of_moving_levels);
   person_index_list_->push_back(p_index_location_moving_level);
 
+  person_index_list_->push_back(new PersonIndexByAgeClassTransition());
+
+  if (Model::CONFIG->using_hybrid_compartmental_mode()) {
+    person_index_list_->push_back(new PersonIndexByCompartment(
+        number_of_location, Model::CONFIG->relative_bitting_info().number_of_biting_levels));
+  }
+}
+
+void Population::move_to_compartment(Person* person) {
+  get_person_index<PersonIndexByCompartment>()->move_to_compartment(person);
+}
+
+void Population::move_out_of_compartment(Person* person) {
+  get_person_index<PersonIndexByCompartment>()->move_out_of_compartment(person);
+  // the immune level decayed from its latest update, as it would have with regular updates
+  person->update();
+  person->schedule_update_every_K_days_event(Model::CONFIG->update_frequency());
+}
+
+void Population::perform_age_class_transitions(const int &current_time) {
+  get_person_index<PersonIndexByAgeClassTransition>()->perform_transitions(current_time);
 }
 
 void Population::perform_interupted_feeding_recombination() {
@@ -817,9 +937,8 @@ void Population::perform_interupted_feeding_recombination() {
     }
     //weight Z with eafar and divide by a and calculate current_force_of_infection
     for (auto loc = 0; loc < Model::CONFIG->number_of_locations(); loc++) {
-      auto new_z = std::vector<unsigned int>(Model::CONFIG->number_of_parasite_types(), 0);
-      Model::RANDOM->random_multinomial(static_cast<const int &>(eafar[loc].size()),
-                                        static_cast<const unsigned int &>(sum_z), &eafar[loc][0], &new_z[0]);
+      const auto &new_z = recombination_sampler_.sample(Model::RANDOM, &eafar[loc][0], eafar[loc].size(),
+                                                        static_cast<unsigned int>(sum_z));
 
       for (auto parasite_type_id = 0;
            parasite_type_id < Model::CONFIG->number_of_parasite_types(); parasite_type_id++) {
@@ -13,6 +13,7 @@
 #include "Person.h"
 #include "Properties/PersonIndex.h"
 #include "Core/Dispatcher.h"
+#include "Core/MultinomialSampler.h"
 #include <vector>
 
 //#include "PersonIndexByLocationStateAgeClass.h"
@@ -85,7 +86,8 @@ class Population : public Dispatcher {
 
   virtual std::size_t size(const int &location, const Person::HostStates &hs, const int &age_class);
 
-  virtual void perform_infection_event();
+  /// number_of_days > 1 draws the infectious bites of a tau leap at once, see Scheduler::population_event_step
+  virtual void perform_infection_event(const int &number_of_days = 1);
 
   virtual void initialize();
 
@@ -105,27 +107,69 @@ class Population : public Dispatcher {
 
   void update_force_of_infection(const int &current_time);
 
-  void perform_birth_event();
+  void perform_birth_event(const int &number_of_days = 1);
 
-  void perform_death_event();
+  /// updates the age class of the persons turning an age_structure boundary today
+  void perform_age_class_transitions(const int &current_time);
+
+  /// the dead persons are removed even when no death is drawn today (number_of_days = 0)
+  void perform_death_event(const int &number_of_days = 1);
 
   void give_1_birth(const int &location);
 
   void clear_all_dead_state_individual();
 
-  void perform_circulation_event();
+  void perform_circulation_event(const int &number_of_days = 1);
 
   void perform_circulation_for_1_location(const int &from_location, const int &target_location,
                                           const int &number_of_circulation,
                                           std::vector<Person *> &today_circulations);
 
+  /**
+   * Sparse movement mode: each leaver draws its destination from the alias table of its origin, so the cost is
+   * proportional to the number of leavers instead of the number of destinations. The alias tables are only rebuilt
+   * after the residents are recounted, see SpatialModel::update_residents
+   */
+  void perform_sparse_circulation_from_1_location(const int &from_location, const int &number_of_leavers,
+                                                  std::vector<Person *> &today_circulations);
+
   bool has_0_case();
 
   void initialize_person_indices();
 
   void perform_interupted_feeding_recombination();
 
+  /// hybrid compartmental mode: the person is no longer updated, see PersonIndexByCompartment
+  void move_to_compartment(Person *person);
+
+  /// brings the person up to date and resumes its updates every update_frequency days
+  void move_out_of_compartment(Person *person);
+
   std::size_t size_residents_only(const int &location);
+
+ private:
+  void perform_infectious_bite(Person *person, const int &parasite_type_id, const int &number_of_days,
+                               PersonPtrVector &today_infections) const;
+
+  /**
+   * Infectious bites on the compartment of a location and biting level. When the bites do not have to be counted per
+   * person, only the bites that may cause an infection are drawn: a binomial number of bites with the largest
+   * probability of infection, each of which infects its host with the ratio of the host's probability to the largest
+   * one.
+   */
+  void perform_infectious_bites_on_compartment(const PersonPtrVector &compartment, const int &parasite_type_id,
+                                               const unsigned int &number_of_bites,
+                                               PersonPtrVector &today_infections) const;
+
+  // buffers reused by the daily multinomial draws
+  MultinomialSampler biting_level_sampler_;
+  MultinomialSampler moving_level_sampler_;
+  MultinomialSampler destination_sampler_;
+  MultinomialSampler recombination_sampler_;
+
+  // sparse movement mode, number of leavers by destination and the destinations drawn today
+  UIntVector leavers_by_destination_;
+  IntVector drawn_destinations_;
 };
 
 template<typename T>
@@ -0,0 +1,90 @@
+//
+// PersonIndexByAgeClassTransition.cpp
+//
+
+#include <algorithm>
+#include "PersonIndexByAgeClassTransition.h"
+#include "PersonIndexByAgeClassTransitionHandler.h"
+#include "Core/Config/Config.h"
+#include "Model.h"
+
+PersonIndexByAgeClassTransition::PersonIndexByAgeClassTransition() = default;
+
+PersonIndexByAgeClassTransition::~PersonIndexByAgeClassTransition() = default;
+
+void PersonIndexByAgeClassTransition::add(Person *p) {
+  add(p, p->age_class());
+}
+
+void PersonIndexByAgeClassTransition::add(Person *p, const int &age_class) {
+  p->PersonIndexByAgeClassTransitionHandler::set_index(-1);
+  p->set_age_class_transition_time(-1);
+  if (!p->has_birth_date() || age_class < 0 || age_class >= Model::CONFIG->number_of_age_classes() - 1) {
+    return;
+  }
+
+  // never file a person under a day whose transitions were already performed
+  const auto time = std::max(p->time_of_age(Model::CONFIG->age_structure()[age_class]), last_performed_time_ + 1);
+  if (time >= static_cast<int>(vPerson_.size())) {
+    vPerson_.resize(time + 1);
+  }
+  vPerson_[time].push_back(p);
+  p->PersonIndexByAgeClassTransitionHandler::set_index(vPerson_[time].size() - 1);
+  p->set_age_class_transition_time(time);
+  size_++;
+}
+
+void PersonIndexByAgeClassTransition::remove(Person *p) {
+  const auto time = p->age_class_transition_time();
+  if (time < 0) {
+    return;
+  }
+  auto &persons = vPerson_[time];
+  const auto index = p->PersonIndexByAgeClassTransitionHandler::index();
+  persons.back()->PersonIndexByAgeClassTransitionHandler::set_index(index);
+  persons[index] = persons.back();
+  persons.pop_back();
+  p->PersonIndexByAgeClassTransitionHandler::set_index(-1);
+  p->set_age_class_transition_time(-1);
+  size_--;
+}
+
+std::size_t PersonIndexByAgeClassTransition::size() const {
+  return size_;
+}
+
+void PersonIndexByAgeClassTransition::update() {}
+
+void PersonIndexByAgeClassTransition::notify_change(Person *p, const Person::Property &property,
+                                                    const void *oldValue, const void *newValue) {
+  if (property==Person::AGE_CLASS) {
+    remove(p);
+    add(p, *(int *) newValue);
+  }
+}
+
+void PersonIndexByAgeClassTransition::perform_transitions(const int &time) {
+  last_performed_time_ = std::max(last_performed_time_, time);
+  if (time < 0 || time >= static_cast<int>(vPerson_.size()) || vPerson_[time].empty()) {
+    return;
+  }
+
+  today_persons_.clear();
+  today_persons_.swap(vPerson_[time]);
+  // the day is over, release its memory
+  PersonPtrVector().swap(vPerson_[time]);
+  for (auto *p : today_persons_) {
+    p->PersonIndexByAgeClassTransitionHandler::set_index(-1);
+    p->set_age_class_transition_time(-1);
+  }
+  size_ -= today_persons_.size();
+
+  for (auto *p : today_persons_) {
+    p->update_age_class();
+    if (p->age_class_transition_time()==-1) {
+      // the age class did not change, file the person under its next transition
+      add(p);
+    }
+  }
+  today_persons_.clear();
+}
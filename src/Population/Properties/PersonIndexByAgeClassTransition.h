@@ -0,0 +1,51 @@
+//
+// PersonIndexByAgeClassTransition.h
+//
+
+#ifndef PERSONINDEXBYAGECLASSTRANSITION_H
+#define PERSONINDEXBYAGECLASSTRANSITION_H
+
+#include "Core/PropertyMacro.h"
+#include "Core/TypeDef.h"
+#include "../Person.h"
+#include "PersonIndex.h"
+
+/**
+ * Calendar of the age class transitions: vPerson()[t] holds the persons whose age crosses the next age_structure
+ * boundary on day t. Ages are derived from the birth date, so these are the only persons whose age class has to be
+ * updated on day t. Persons without a birth date or in the last age class are not in the index.
+ */
+class PersonIndexByAgeClassTransition : public PersonIndex {
+ DISALLOW_COPY_AND_ASSIGN(PersonIndexByAgeClassTransition)
+
+ PROPERTY_REF(PersonPtrVector2, vPerson)
+
+ public:
+  PersonIndexByAgeClassTransition();
+
+  virtual ~PersonIndexByAgeClassTransition();
+
+  void add(Person *p) override;
+
+  void remove(Person *p) override;
+
+  std::size_t size() const override;
+
+  void update() override;
+
+  void notify_change(Person *p, const Person::Property &property, const void *oldValue, const void *newValue) override;
+
+  /// updates the age class of the persons of day time, who are then filed under their next transition
+  void perform_transitions(const int &time);
+
+ private:
+  void add(Person *p, const int &age_class);
+
+  PersonPtrVector today_persons_;
+
+  std::size_t size_{0};
+
+  int last_performed_time_{-1};
+};
+
+#endif // PERSONINDEXBYAGECLASSTRANSITION_H
@@ -0,0 +1,9 @@
+//
+// PersonIndexByAgeClassTransitionHandler.cpp
+//
+
+#include "PersonIndexByAgeClassTransitionHandler.h"
+
+PersonIndexByAgeClassTransitionHandler::PersonIndexByAgeClassTransitionHandler() : age_class_transition_time_(-1) {}
+
+PersonIndexByAgeClassTransitionHandler::~PersonIndexByAgeClassTransitionHandler() = default;
@@ -0,0 +1,23 @@
+//
+// PersonIndexByAgeClassTransitionHandler.h
+//
+
+#ifndef PERSONINDEXBYAGECLASSTRANSITIONHANDLER_H
+#define PERSONINDEXBYAGECLASSTRANSITIONHANDLER_H
+
+#include "Core/PropertyMacro.h"
+#include "IndexHandler.h"
+
+class PersonIndexByAgeClassTransitionHandler : public IndexHandler {
+ DISALLOW_COPY_AND_ASSIGN(PersonIndexByAgeClassTransitionHandler)
+
+  // simulation time of the next change of age class, -1 when there is none
+ PROPERTY_REF(int, age_class_transition_time)
+
+ public:
+  PersonIndexByAgeClassTransitionHandler();
+
+  virtual ~PersonIndexByAgeClassTransitionHandler();
+};
+
+#endif // PERSONINDEXBYAGECLASSTRANSITIONHANDLER_H
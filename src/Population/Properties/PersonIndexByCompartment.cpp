@@ -0,0 +1,88 @@
+//
+// PersonIndexByCompartment.cpp
+//
+
+#include "PersonIndexByCompartment.h"
+#include "PersonIndexByCompartmentHandler.h"
+#include <cassert>
+
+PersonIndexByCompartment::PersonIndexByCompartment(const int &no_location, const int &no_level) :
+    vPerson_(no_location, PersonPtrVector2(no_level)), compartments_(no_location, PersonPtrVector2(no_level)) {}
+
+PersonIndexByCompartment::~PersonIndexByCompartment() = default;
+
+void PersonIndexByCompartment::add(Person *p) {
+  assert(vPerson_.size() > p->location() && p->location() >= 0);
+  assert(vPerson_[p->location()].size() > p->bitting_level());
+  add(p, p->location(), p->bitting_level());
+  if (p->in_compartment()) {
+    number_of_persons_in_compartments_++;
+  }
+}
+
+void PersonIndexByCompartment::remove(Person *p) {
+  remove_without_set_index(p);
+  p->PersonIndexByCompartmentHandler::set_index(-1);
+  if (p->in_compartment()) {
+    number_of_persons_in_compartments_--;
+    p->set_in_compartment(false);
+  }
+}
+
+std::size_t PersonIndexByCompartment::size() const {
+  return number_of_persons_in_compartments_;
+}
+
+void PersonIndexByCompartment::update() {
+  for (auto *groups : {&vPerson_, &compartments_}) {
+    for (auto &location : *groups) {
+      for (auto &persons : location) {
+        PersonPtrVector(persons).swap(persons);
+      }
+    }
+  }
+}
+
+void PersonIndexByCompartment::notify_change(Person *p, const Person::Property &property, const void *oldValue,
+                                             const void *newValue) {
+  switch (property) {
+    case Person::LOCATION:remove_without_set_index(p);
+      add(p, *(int *) newValue, p->bitting_level());
+      break;
+    case Person::BITTING_LEVEL:remove_without_set_index(p);
+      add(p, p->location(), *(int *) newValue);
+      break;
+    default:break;
+  }
+}
+
+void PersonIndexByCompartment::move_to_compartment(Person *p) {
+  assert(!p->in_compartment());
+  remove_without_set_index(p);
+  p->set_in_compartment(true);
+  add(p, p->location(), p->bitting_level());
+  number_of_persons_in_compartments_++;
+}
+
+void PersonIndexByCompartment::move_out_of_compartment(Person *p) {
+  assert(p->in_compartment());
+  remove_without_set_index(p);
+  p->set_in_compartment(false);
+  add(p, p->location(), p->bitting_level());
+  number_of_persons_in_compartments_--;
+}
+
+void PersonIndexByCompartment::add(Person *p, const int &location, const int &bitting_level) {
+  auto &persons = p->in_compartment() ? compartments_[location][bitting_level] : vPerson_[location][bitting_level];
+  persons.push_back(p);
+  p->PersonIndexByCompartmentHandler::set_index(persons.size() - 1);
+}
+
+void PersonIndexByCompartment::remove_without_set_index(Person *p) {
+  auto &persons = p->in_compartment() ? compartments_[p->location()][p->bitting_level()]
+                                      : vPerson_[p->location()][p->bitting_level()];
+  const auto index = p->PersonIndexByCompartmentHandler::index();
+  persons.back()->PersonIndexByCompartmentHandler::set_index(index);
+  persons[index] = persons.back();
+  persons.pop_back();
+}
@@ -0,0 +1,55 @@
+//
+// PersonIndexByCompartment.h
+//
+
+#ifndef PERSONINDEXBYCOMPARTMENT_H
+#define PERSONINDEXBYCOMPARTMENT_H
+
+#include "Core/PropertyMacro.h"
+#include "Core/TypeDef.h"
+#include "../Person.h"
+#include "PersonIndex.h"
+
+/**
+ * Hybrid compartmental mode: the persons by location and biting level, split into the persons simulated individually
+ * (vPerson) and the persons held in a compartment (compartments). A person joins the compartment of its location and
+ * biting level when it is uninfected and has no drug in blood. It then only ages and loses immunity, which are
+ * evaluated from the birth date and the closed form of the immune decay, so it is no longer updated and the bites on
+ * a compartment are drawn in aggregate. It leaves the compartment when it is infected or receives a therapy.
+ */
+class PersonIndexByCompartment : public PersonIndex {
+ DISALLOW_COPY_AND_ASSIGN(PersonIndexByCompartment)
+
+ PROPERTY_REF(PersonPtrVector3, vPerson)
+
+ PROPERTY_REF(PersonPtrVector3, compartments)
+
+ public:
+  PersonIndexByCompartment(const int &no_location = 1, const int &no_level = 1);
+
+  virtual ~PersonIndexByCompartment();
+
+  void add(Person *p) override;
+
+  void remove(Person *p) override;
+
+  /// number of persons held in compartments
+  std::size_t size() const override;
+
+  void update() override;
+
+  void notify_change(Person *p, const Person::Property &property, const void *oldValue, const void *newValue) override;
+
+  void move_to_compartment(Person *p);
+
+  void move_out_of_compartment(Person *p);
+
+ private:
+  void add(Person *p, const int &location, const int &bitting_level);
+
+  void remove_without_set_index(Person *p);
+
+  std::size_t number_of_persons_in_compartments_{0};
+};
+
+#endif // PERSONINDEXBYCOMPARTMENT_H
@@ -0,0 +1,9 @@
+//
+// PersonIndexByCompartmentHandler.cpp
+//
+
+#include "PersonIndexByCompartmentHandler.h"
+
+PersonIndexByCompartmentHandler::PersonIndexByCompartmentHandler() : in_compartment_(false) {}
+
+PersonIndexByCompartmentHandler::~PersonIndexByCompartmentHandler() = default;
@@ -0,0 +1,23 @@
+//
+// PersonIndexByCompartmentHandler.h
+//
+
+#ifndef PERSONINDEXBYCOMPARTMENTHANDLER_H
+#define PERSONINDEXBYCOMPARTMENTHANDLER_H
+
+#include "Core/PropertyMacro.h"
+#include "IndexHandler.h"
+
+class PersonIndexByCompartmentHandler : public IndexHandler {
+ DISALLOW_COPY_AND_ASSIGN(PersonIndexByCompartmentHandler)
+
+  // true while the host is held in a compartment of the hybrid compartmental mode
+ PROPERTY_REF(bool, in_compartment)
+
+ public:
+  PersonIndexByCompartmentHandler();
+
+  virtual ~PersonIndexByCompartmentHandler();
+};
+
+#endif // PERSONINDEXBYCOMPARTMENTHANDLER_H
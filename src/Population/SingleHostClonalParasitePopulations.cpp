@@ -13,6 +13,7 @@
 #include "Core/Config/Config.h"
 #include "DrugsInBlood.h"
 #include "Therapies/Drug.h"
+#include "Therapies/DrugType.h"
 #include "Core/Random.h"
 #include "MDC/ModelDataCollector.h"
 #include "Helpers/NumberHelpers.h"
@@ -21,6 +22,18 @@
 
 OBJECTPOOL_IMPL(SingleHostClonalParasitePopulations)
 
+namespace {
+// scratch buffers of update_by_drugs, shared by every host
+IntVector drug_ids_buffer;
+DoubleVector concentration_power_n_buffer;
+DoubleVector maximum_killing_rate_buffer;
+IntVector genotype_ids_buffer;
+DoubleVector killing_rate_buffer;
+
+// scratch buffer of change_all_genotypes
+std::vector<Genotype*> genotypes_buffer;
+}
+
 SingleHostClonalParasitePopulations::SingleHostClonalParasitePopulations(Person* person) : person_(person),
                                                                                            parasites_(nullptr),
                                                                                            relative_effective_parasite_density_(
@@ -53,6 +66,7 @@ SingleHostClonalParasitePopulations::~SingleHostClonalParasitePopulations() {
 void SingleHostClonalParasitePopulations::clear() {
   if (parasites_->empty()) { return; }
   remove_all_infection_force();
+  remove_from_genotype_census();
 
   for (auto& parasite : *parasites_) {
     delete parasite;
@@ -64,9 +78,42 @@ void SingleHostClonalParasitePopulations::clear() {
 void SingleHostClonalParasitePopulations::add(ClonalParasitePopulation* blood_parasite) {
   blood_parasite->set_parasite_population(this);
 
+  remove_from_genotype_census();
   parasites_->push_back(blood_parasite);
   blood_parasite->set_index(parasites_->size() - 1);
   assert(parasites_->at(blood_parasite->index()) == blood_parasite);
+  add_to_genotype_census();
+}
+
+void SingleHostClonalParasitePopulations::add_infection(ClonalParasitePopulation* blood_parasite) {
+  remove_all_infection_force();
+  add(blood_parasite);
+  add_all_infection_force();
+}
+
+void SingleHostClonalParasitePopulations::change_all_genotypes(
+    const std::function<Genotype *(Genotype *)>& conversion) {
+  genotypes_buffer.clear();
+  auto changed = false;
+  for (auto* blood_parasite : *parasites_) {
+    genotypes_buffer.push_back(conversion(blood_parasite->genotype()));
+    changed = changed || genotypes_buffer.back() != blood_parasite->genotype();
+  }
+  if (!changed) {
+    return;
+  }
+
+  remove_all_infection_force();
+  remove_from_genotype_census();
+  for (std::size_t i = 0; i < parasites_->size(); i++) {
+    // detached, set_genotype does not update the host
+    auto* blood_parasite = (*parasites_)[i];
+    blood_parasite->set_parasite_population(nullptr);
+    blood_parasite->set_genotype(genotypes_buffer[i]);
+    blood_parasite->set_parasite_population(this);
+  }
+  add_to_genotype_census();
+  add_all_infection_force();
 }
 
 void SingleHostClonalParasitePopulations::remove(ClonalParasitePopulation* blood_parasite) {
@@ -85,6 +132,7 @@ void SingleHostClonalParasitePopulations::remove(const int& index) {
   //    std::cout << parasites_.size() << std::endl;
   //Remove all infection force
   remove_all_infection_force();
+  remove_from_genotype_census();
 
   //    BloodParasite* last_parasite = parasites_.back();
 
@@ -93,6 +141,8 @@ void SingleHostClonalParasitePopulations::remove(const int& index) {
   parasites_->pop_back();
   bp->set_index(-1);
 
+  add_to_genotype_census();
+
   //    for(BloodParasite* bp :  parasites_) {
   //        std::cout << bp->index()<< "\t";
   //    }
@@ -144,6 +194,16 @@ void SingleHostClonalParasitePopulations::change_all_infection_force(const doubl
   }
 }
 
+void SingleHostClonalParasitePopulations::remove_from_genotype_census() const {
+  if (person_ == nullptr || Model::DATA_COLLECTOR == nullptr) { return; }
+  Model::DATA_COLLECTOR->genotype_census().remove_host(person_);
+}
+
+void SingleHostClonalParasitePopulations::add_to_genotype_census() const {
+  if (person_ == nullptr || Model::DATA_COLLECTOR == nullptr) { return; }
+  Model::DATA_COLLECTOR->genotype_census().add_host(person_);
+}
+
 void SingleHostClonalParasitePopulations::update_relative_effective_parasite_density_without_free_recombination() {
   std::vector<double> relative_parasite_density(size(), 0.0);
   get_parasites_profiles(relative_parasite_density, log10_total_relative_density_);
@@ -321,12 +381,32 @@ void SingleHostClonalParasitePopulations::clear_cured_parasites() {
 }
 
 void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in_blood) const {
-  for (auto& blood_parasite : *parasites_) {
+  const auto number_of_clones = parasites_->size();
+  const auto number_of_drugs = drugs_in_blood->size();
+  if (number_of_clones == 0 || number_of_drugs == 0) {
+    return;
+  }
+
+  // flat per-host drug state, in the order of the drugs in blood
+  drug_ids_buffer.resize(number_of_drugs);
+  concentration_power_n_buffer.resize(number_of_drugs);
+  maximum_killing_rate_buffer.resize(number_of_drugs);
+  auto d = 0ul;
+  for (auto* drug = drugs_in_blood->begin(); drug != drugs_in_blood->end(); ++drug, ++d) {
+    auto* drug_type = drug->drug_type();
+    drug_ids_buffer[d] = drug->drug_type_id();
+    concentration_power_n_buffer[d] = drug_type->get_concentration_power_n(drug->last_update_value());
+    maximum_killing_rate_buffer[d] = drug_type->maximum_parasite_killing_rate();
+  }
+
+  // mutations first, keeping the genotype each drug acts on (a mutation selected by a drug is already acted on by it)
+  genotype_ids_buffer.resize(number_of_clones * number_of_drugs);
+  for (auto c = 0ul; c < number_of_clones; c++) {
+    auto* blood_parasite = (*parasites_)[c];
     auto* new_genotype = blood_parasite->genotype();
 
-    double percent_parasite_remove = 0;
-    for (auto it = drugs_in_blood->drugs()->begin(); it != drugs_in_blood->drugs()->end(); ++it) {
-      const auto drug = it->second;
+    d = 0;
+    for (auto* drug = drugs_in_blood->begin(); drug != drugs_in_blood->end(); ++drug, ++d) {
       const auto p = Model::RANDOM->random_flat(0.0, 1.0);
 
       if (p < drug->get_mutation_probability()) {
@@ -335,9 +415,8 @@ void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in
         //TODO: rework here to only allow x to mutate after intervention day
         int mutation_locus = Model::RANDOM->random_uniform_int(0, new_genotype->gene_expression().size());
 
-        auto new_allele_value = blood_parasite->genotype()->select_mutation_allele(mutation_locus);
-        //                std::cout << mutation_locus << "-" << bloodParasite->genotype()->gene_expression()[mutation_locus] << "-" << new_allele_value << std::endl;
-        auto* mutation_genotype = new_genotype->combine_mutation_to(mutation_locus, new_allele_value);
+        // new_genotype is still the genotype of blood_parasite here, the mutation is a lookup in the mutation table
+        auto* mutation_genotype = Model::CONFIG->genotype_db()->mutate(new_genotype, mutation_locus, Model::RANDOM);
 
         //                if (drug->drug_type()->id() == 3) {
         //                    std::cout << drug->getMutationProbability() << std::endl;
@@ -370,15 +449,23 @@ void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in
         blood_parasite->set_genotype(new_genotype);
       }
 
-      const auto p_temp = drug->get_parasite_killing_rate(blood_parasite->genotype()->genotype_id());
-
-      percent_parasite_remove = percent_parasite_remove + p_temp - percent_parasite_remove * p_temp;
+      genotype_ids_buffer[c * number_of_drugs + d] = blood_parasite->genotype()->genotype_id();
     }
+  }
+
+  killing_rate_buffer.resize(number_of_clones * number_of_drugs);
+  DrugType::get_parasite_killing_rates(Model::CONFIG->EC50_power_n_table(), genotype_ids_buffer.data(),
+                                       number_of_clones, drug_ids_buffer.data(),
+                                       concentration_power_n_buffer.data(), maximum_killing_rate_buffer.data(),
+                                       number_of_drugs, killing_rate_buffer.data());
+
+  for (auto c = 0ul; c < number_of_clones; c++) {
+    const auto percent_parasite_remove = DrugType::get_percent_parasite_remove(
+        killing_rate_buffer.data() + c * number_of_drugs, number_of_drugs);
     if (percent_parasite_remove > 0) {
-      blood_parasite->perform_drug_action(percent_parasite_remove);
+      (*parasites_)[c]->perform_drug_action(percent_parasite_remove);
     }
   }
-
 }
 
 bool SingleHostClonalParasitePopulations::has_detectable_parasite() const {
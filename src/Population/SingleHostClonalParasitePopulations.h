@@ -11,10 +11,13 @@
 #include "Core/PropertyMacro.h"
 #include "Core/ObjectPool.h"
 #include "Core/TypeDef.h"
+#include <functional>
 #include <vector>
 
 class ClonalParasitePopulation;
 
+class Genotype;
+
 class Person;
 
 class DrugType;
@@ -46,6 +49,15 @@ class SingleHostClonalParasitePopulations {
 
   virtual void add(ClonalParasitePopulation *blood_parasite);
 
+  /**
+   * Adds a clone whose density and gametocyte level are already set, the force of infection of the host is updated
+   * once instead of once per setter.
+   */
+  void add_infection(ClonalParasitePopulation *blood_parasite);
+
+  /// replaces the genotype of every clone, with one update of the force of infection and the genotype census
+  void change_all_genotypes(const std::function<Genotype *(Genotype *)> &conversion);
+
   virtual void remove(ClonalParasitePopulation *blood_parasite);
 
   virtual void remove(const int &index);
@@ -56,6 +68,10 @@ class SingleHostClonalParasitePopulations {
 
   virtual void change_all_infection_force(const double &sign);
 
+  void remove_from_genotype_census() const;
+
+  void add_to_genotype_census() const;
+
   virtual double get_log10_total_relative_density();
 
   virtual int latest_update_time() const;
@@ -0,0 +1,58 @@
+//
+// ComparisonReporter.cpp
+//
+
+#include "ComparisonReporter.h"
+#include "Model.h"
+#include "Core/Config/Config.h"
+#include "Core/Scheduler.h"
+#include "MDC/ModelDataCollector.h"
+#include "Population/Population.h"
+
+const std::vector<std::string> ComparisonReporter::STATISTIC_NAMES{
+    "blood_slide_prevalence", "immune_value", "monthly_new_infections", "monthly_clinical_episodes",
+    "monthly_treatments", "final_population_size"
+};
+
+ComparisonReporter::ComparisonReporter(std::vector<double> *statistics) : statistics_(statistics),
+                                                                          sums_(NUMBER_OF_STATISTICS, 0.0) {}
+
+void ComparisonReporter::initialize() {
+  Model::DATA_COLLECTOR->metric_registry().require(MetricRegistry::IMMUNITY);
+}
+
+void ComparisonReporter::before_run() {}
+
+void ComparisonReporter::begin_time_step() {}
+
+void ComparisonReporter::monthly_report() {
+  if (Model::SCHEDULER->current_time() < Model::CONFIG->start_collect_data_day()) return;
+
+  auto population_size = 0.0;
+  auto number_of_positives = 0.0;
+  auto total_immune = 0.0;
+  for (auto loc = 0; loc < Model::CONFIG->number_of_locations(); loc++) {
+    const auto popsize = Model::DATA_COLLECTOR->popsize_by_location()[loc];
+    population_size += popsize;
+    number_of_positives += Model::DATA_COLLECTOR->blood_slide_prevalence_by_location()[loc]*popsize;
+    total_immune += Model::DATA_COLLECTOR->total_immune_by_location()[loc];
+    sums_[NEW_INFECTIONS] += Model::DATA_COLLECTOR->monthly_number_of_new_infections_by_location()[loc];
+    sums_[CLINICAL_EPISODES] += Model::DATA_COLLECTOR->monthly_number_of_clinical_episode_by_location()[loc];
+    sums_[TREATMENTS] += Model::DATA_COLLECTOR->monthly_number_of_treatment_by_location()[loc];
+  }
+  if (population_size > 0) {
+    sums_[BLOOD_SLIDE_PREVALENCE] += number_of_positives/population_size;
+    sums_[IMMUNE_VALUE] += total_immune/population_size;
+  }
+  number_of_months_++;
+}
+
+void ComparisonReporter::after_run() {
+  statistics_->assign(NUMBER_OF_STATISTICS, 0.0);
+  if (number_of_months_ > 0) {
+    for (auto i = 0; i < POPULATION_SIZE; i++) {
+      (*statistics_)[i] = sums_[i]/number_of_months_;
+    }
+  }
+  (*statistics_)[POPULATION_SIZE] = Model::POPULATION->size();
+}
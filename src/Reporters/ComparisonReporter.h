@@ -0,0 +1,56 @@
+//
+// ComparisonReporter.h
+//
+
+#ifndef COMPARISONREPORTER_H
+#define COMPARISONREPORTER_H
+
+#include <string>
+#include <vector>
+#include "Core/PropertyMacro.h"
+#include "Reporter.h"
+
+/**
+ * Collects the summary statistics compared by ModeComparison: the monthly means, from start_collect_data_day, of the
+ * blood slide prevalence, the immune value, the new infections, the clinical episodes and the treatments, and the
+ * population size at the end of the run. They are written into statistics after the run.
+ */
+class ComparisonReporter : public Reporter {
+ DISALLOW_COPY_AND_ASSIGN(ComparisonReporter)
+
+ DISALLOW_MOVE(ComparisonReporter)
+
+ public:
+  enum Statistic {
+    BLOOD_SLIDE_PREVALENCE = 0,
+    IMMUNE_VALUE,
+    NEW_INFECTIONS,
+    CLINICAL_EPISODES,
+    TREATMENTS,
+    POPULATION_SIZE,
+    NUMBER_OF_STATISTICS
+  };
+
+  static const std::vector<std::string> STATISTIC_NAMES;
+
+  explicit ComparisonReporter(std::vector<double> *statistics);
+
+  ~ComparisonReporter() override = default;
+
+  void initialize() override;
+
+  void before_run() override;
+
+  void after_run() override;
+
+  void begin_time_step() override;
+
+  void monthly_report() override;
+
+ private:
+  std::vector<double> *statistics_;
+  std::vector<double> sums_;
+  int number_of_months_{0};
+};
+
+#endif // COMPARISONREPORTER_H
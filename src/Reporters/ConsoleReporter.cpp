@@ -24,6 +24,10 @@ ConsoleReporter::~ConsoleReporter() {
 }
 
 void ConsoleReporter::initialize() {
+  auto& metric_registry = Model::DATA_COLLECTOR->metric_registry();
+  metric_registry.require(MetricRegistry::AMU_AFU);
+  metric_registry.require(MetricRegistry::PERCENTAGE_BITES_ON_TOP_20);
+  metric_registry.require(MetricRegistry::IMMUNITY);
 }
 
 void ConsoleReporter::before_run() {
@@ -20,7 +20,11 @@
 
 MMCReporter::MMCReporter() = default;
 
-void MMCReporter::initialize() { }
+void MMCReporter::initialize() {
+  auto& metric_registry = Model::DATA_COLLECTOR->metric_registry();
+  metric_registry.require(MetricRegistry::GENOTYPE_CENSUS);
+  metric_registry.require(MetricRegistry::AGE_GROUP_BY_5);
+}
 
 void MMCReporter::before_run() {
   // // std::cout << "MMC Reporter" << std::endl;
@@ -74,7 +78,7 @@ void MMCReporter::monthly_report() {
 
   output_genotype_frequency_3(
       Model::CONFIG->number_of_parasite_types(),
-      Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>());
+      Model::DATA_COLLECTOR->genotype_census());
 
   ss << group_sep;
   print_ntf_by_location();
@@ -147,55 +151,15 @@ void MMCReporter::print_EIR_PfPR_by_location() {
 
 void MMCReporter::output_genotype_frequency_3(
     const int& number_of_genotypes,
-    PersonIndexByLocationStateAgeClass* pi
+    GenotypeCensus& census
 ) {
-  auto sum1_all = 0.0;
-  std::vector<double> result3_all(number_of_genotypes, 0.0);
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
+  const auto number_of_locations = census.number_of_infected_hosts_by_location().size();
 
   for (auto loc = 0; loc < number_of_locations; loc++) {
-    std::vector<double> result3(number_of_genotypes, 0.0);
-    auto sum1 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ull; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->all_clonal_parasite_populations()->parasites()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
-
-          std::map<int, int> individual_genotype_map;
-
-          for (auto* parasite_population : *(person->all_clonal_parasite_populations()->parasites())) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            if (individual_genotype_map.find(g_id) == individual_genotype_map.end()) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result3[genotype.first] += genotype.second /
-                                       static_cast<double>(person->all_clonal_parasite_populations()
-                                                                 ->parasites()
-                                                                 ->size()
-                                       );
-            result3_all[genotype.first] += genotype.second / static_cast<double>(person
-                ->all_clonal_parasite_populations()->parasites()->size());
-          }
-        }
-      }
-    }
+    const double sum1 = census.number_of_infected_hosts_by_location()[loc];
     // output per location
-    for (auto& i : result3) {
-      i /= sum1;
-      ss << i << sep;
+    for (auto g_id = 0; g_id < number_of_genotypes; g_id++) {
+      ss << census.weighted_number_of_hosts(loc, g_id) / sum1 << sep;
     }
   }
 }
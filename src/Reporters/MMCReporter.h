@@ -5,7 +5,7 @@
 #include "Reporter.h"
 #include <sstream>
 
-class PersonIndexByLocationStateAgeClass;
+class GenotypeCensus;
 
 class MMCReporter : public Reporter {
 DISALLOW_COPY_AND_ASSIGN(MMCReporter)
@@ -43,7 +43,7 @@ public:
 private:
   void output_genotype_frequency_3(
       const int& number_of_genotypes,
-      PersonIndexByLocationStateAgeClass* pi
+      GenotypeCensus& census
   );
 };
 
@@ -0,0 +1,113 @@
+//
+// ModeComparison.cpp
+//
+
+#include "ModeComparison.h"
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <fmt/format.h>
+#include "easylogging++.h"
+#include "ComparisonReporter.h"
+#include "Model.h"
+
+namespace {
+void mean_and_variance(const std::vector<double> &samples, double &mean, double &variance) {
+  mean = std::accumulate(samples.begin(), samples.end(), 0.0)/samples.size();
+  variance = 0;
+  for (const auto &sample : samples) {
+    variance += (sample - mean)*(sample - mean);
+  }
+  variance = samples.size() > 1 ? variance/(samples.size() - 1) : 0;
+}
+}
+
+ModeComparison::ModeComparison(std::string config_filename, std::string overrides, const int &number_of_replicates,
+                               const unsigned long &initial_seed) : config_filename_(std::move(config_filename)),
+                                                                    overrides_(std::move(overrides)),
+                                                                    number_of_replicates_(number_of_replicates),
+                                                                    initial_seed_(initial_seed) {}
+
+bool ModeComparison::run() {
+  std::vector<std::vector<double>> samples(ComparisonReporter::NUMBER_OF_STATISTICS);
+  std::vector<std::vector<double>> samples_with_overrides(ComparisonReporter::NUMBER_OF_STATISTICS);
+  auto running_time = 0.0;
+  auto running_time_with_overrides = 0.0;
+
+  for (auto replicate = 0; replicate < number_of_replicates_; replicate++) {
+    const auto seed = initial_seed_ + replicate;
+    auto time = 0.0;
+    const auto statistics = run_replicate("", seed, time);
+    running_time += time;
+    const auto statistics_with_overrides = run_replicate(overrides_, seed, time);
+    running_time_with_overrides += time;
+
+    for (auto i = 0; i < ComparisonReporter::NUMBER_OF_STATISTICS; i++) {
+      samples[i].push_back(statistics[i]);
+      samples_with_overrides[i].push_back(statistics_with_overrides[i]);
+    }
+  }
+
+  results_.clear();
+  auto passed = true;
+  fmt::print("Comparison of {} with {} over {} replicates\n", config_filename_, overrides_, number_of_replicates_);
+  fmt::print("{:<28}{:>16}{:>16}{:>10}{:>12}{:>8}\n", "statistic", "full model", "overrides", "z", "rel. diff",
+             "");
+  for (auto i = 0; i < ComparisonReporter::NUMBER_OF_STATISTICS; i++) {
+    results_.push_back(compare(ComparisonReporter::STATISTIC_NAMES[i], samples[i], samples_with_overrides[i]));
+    const auto &result = results_.back();
+    fmt::print("{:<28}{:>16.6g}{:>16.6g}{:>10.3f}{:>12.4f}{:>8}\n", result.name, result.mean,
+               result.mean_with_overrides, result.z_score, result.relative_difference,
+               result.passed ? "ok" : "FAILED");
+    passed = passed && result.passed;
+  }
+  fmt::print("running time (s): {:.2f} full model, {:.2f} with overrides\n", running_time,
+             running_time_with_overrides);
+  return passed;
+}
+
+ModeComparison::Result ModeComparison::compare(const std::string &name, const std::vector<double> &samples,
+                                               const std::vector<double> &samples_with_overrides,
+                                               const double &max_z_score, const double &max_relative_difference) {
+  Result result;
+  result.name = name;
+  double variance, variance_with_overrides;
+  mean_and_variance(samples, result.mean, variance);
+  mean_and_variance(samples_with_overrides, result.mean_with_overrides, variance_with_overrides);
+
+  const auto difference = result.mean_with_overrides - result.mean;
+  const auto standard_error = std::sqrt(variance/samples.size() + variance_with_overrides/samples_with_overrides.size());
+  result.z_score = standard_error > 0 ? difference/standard_error
+                                      : (difference==0 ? 0 : std::numeric_limits<double>::infinity());
+  result.relative_difference = result.mean==0 ? std::fabs(difference) : std::fabs(difference/result.mean);
+  result.passed = std::fabs(result.z_score) <= max_z_score || result.relative_difference <= max_relative_difference;
+  return result;
+}
+
+const std::vector<ModeComparison::Result> &ModeComparison::results() const {
+  return results_;
+}
+
+std::vector<double> ModeComparison::run_replicate(const std::string &overrides, const unsigned long &seed,
+                                                  double &running_time) {
+  std::vector<double> statistics;
+  const auto start = std::chrono::high_resolution_clock::now();
+
+  auto *model = new Model();
+  model->set_config_filename(config_filename_);
+  model->set_config_overrides(overrides);
+  model->set_initial_seed_number(seed);
+  // the reporter types that are not in Reporter::ReportTypeMap add no reporter
+  model->set_reporter_type("None");
+  model->add_reporter(new ComparisonReporter(&statistics));
+  model->initialize();
+  model->run();
+  delete model;
+
+  running_time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+  LOG(INFO) << fmt::format("Replicate with seed {} and overrides '{}' done in {:.2f}s", seed, overrides,
+                           running_time);
+  return statistics;
+}
@@ -0,0 +1,51 @@
+//
+// ModeComparison.h
+//
+
+#ifndef MODECOMPARISON_H
+#define MODECOMPARISON_H
+
+#include <string>
+#include <vector>
+
+/**
+ * Statistical comparison of a simulation mode with the full model: runs number_of_replicates seeded replicates of
+ * the config file as it is and with the config overrides (ex: "{using_hybrid_compartmental_mode: true}") and compares
+ * the means of the statistics of ComparisonReporter with a Welch z-score. A statistic passes when |z| <= max_z_score
+ * or when the relative difference of the means is at most max_relative_difference.
+ */
+class ModeComparison {
+ public:
+  struct Result {
+    std::string name;
+    double mean{0};
+    double mean_with_overrides{0};
+    double z_score{0};
+    double relative_difference{0};
+    bool passed{true};
+  };
+
+  ModeComparison(std::string config_filename, std::string overrides, const int &number_of_replicates,
+                 const unsigned long &initial_seed = 1);
+
+  /// runs the replicates and prints the comparison, returns true when every statistic passes
+  bool run();
+
+  static Result compare(const std::string &name, const std::vector<double> &samples,
+                        const std::vector<double> &samples_with_overrides, const double &max_z_score = 3.0,
+                        const double &max_relative_difference = 0.02);
+
+  const std::vector<Result> &results() const;
+
+ private:
+  /// runs a new model and returns its statistics and its running time in seconds
+  std::vector<double> run_replicate(const std::string &overrides, const unsigned long &seed, double &running_time);
+
+  std::string config_filename_;
+  std::string overrides_;
+  int number_of_replicates_;
+  unsigned long initial_seed_;
+  std::vector<Result> results_;
+};
+
+#endif // MODECOMPARISON_H
@@ -23,6 +23,9 @@ MonthlyReporter::~MonthlyReporter() = default;
 
 void MonthlyReporter::initialize()
 {
+  auto& metric_registry = Model::DATA_COLLECTOR->metric_registry();
+  metric_registry.require(MetricRegistry::GENOTYPE_CENSUS);
+  metric_registry.require(MetricRegistry::AGE_GROUP_BY_5);
 }
 
 void MonthlyReporter::before_run()
@@ -64,7 +67,7 @@ void MonthlyReporter::monthly_report()
 
 // including total number of positive individuals
   ReporterUtils::output_genotype_frequency3(ss, Model::CONFIG->number_of_parasite_types(),
-                                            Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>());
+                                            Model::DATA_COLLECTOR->genotype_census());
 
 
   CLOG(INFO, "monthly_reporter") << ss.str();
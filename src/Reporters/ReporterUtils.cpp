@@ -5,9 +5,7 @@
 #include <vector>
 #include <Core/Config/Config.h>
 #include "ReporterUtils.h"
-#include "Population/Properties/PersonIndexByLocationStateAgeClass.h"
-#include "Population/SingleHostClonalParasitePopulations.h"
-#include "Population/ClonalParasitePopulation.h"
+#include "MDC/GenotypeCensus.h"
 
 const std::string group_sep = "-1111\t";
 const std::string sep = "\t";
@@ -15,55 +13,21 @@ const std::string sep = "\t";
 
 void ReporterUtils::output_genotype_frequency1(
     std::stringstream& ss, const int& number_of_genotypes,
-    PersonIndexByLocationStateAgeClass* pi
+    GenotypeCensus& census
 ) {
   auto sum1_all = 0.0;
   std::vector<double> result1_all(number_of_genotypes, 0.0);
 
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
+  const auto number_of_locations = census.number_of_infected_hosts_by_location().size();
 
   for (auto loc = 0; loc < number_of_locations; loc++) {
-    std::vector<double> result1(number_of_genotypes, 0.0);
-    auto sum1 = 0.0;
+    const double sum1 = census.number_of_infected_hosts_by_location()[loc];
+    sum1_all += sum1;
 
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ull; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->all_clonal_parasite_populations()->parasites()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
-          // sum2 += person->all_clonal_parasite_populations()->parasites()->size();
-          std::map<int, int> individual_genotype_map;
-
-          for (auto* parasite_population : *(person->all_clonal_parasite_populations()->parasites())) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            // result2[g_id] += 1;
-            if (individual_genotype_map.find(g_id) == individual_genotype_map.end()) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result1[genotype.first] += 1;
-            result1_all[genotype.first] += 1;
-          }
-        }
-      }
-    }
-
-    for (auto& i : result1) {
-      i /= sum1;
-    }
-
-    for (auto& i : result1) {
-      ss << i << sep;
+    for (auto g_id = 0; g_id < number_of_genotypes; g_id++) {
+      const double number_of_hosts = census.number_of_hosts_by_location_genotype()[loc][g_id];
+      result1_all[g_id] += number_of_hosts;
+      ss << number_of_hosts / sum1 << sep;
     }
   }
   ss << group_sep;
@@ -77,45 +41,22 @@ void ReporterUtils::output_genotype_frequency1(
 
 void ReporterUtils::output_genotype_frequency2(
     std::stringstream& ss, const int& number_of_genotypes,
-    PersonIndexByLocationStateAgeClass* pi
+    GenotypeCensus& census
 ) {
   auto sum2_all = 0.0;
   std::vector<double> result2_all(number_of_genotypes, 0.0);
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
+  const auto number_of_locations = census.number_of_clones_by_location().size();
 
   for (auto loc = 0; loc < number_of_locations; loc++) {
-    std::vector<double> result2(number_of_genotypes, 0.0);
-    auto sum2 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ull; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          sum2 += person->all_clonal_parasite_populations()->parasites()->size();
-          sum2_all += sum2;
-          std::map<int, int> individual_genotype_map;
-
-          for (auto* parasite_population : *(person->all_clonal_parasite_populations()->parasites())) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            result2[g_id] += 1;
-            result2_all[g_id] += 1;
-          }
-        }
-      }
-    }
+    const double sum2 = census.number_of_clones_by_location()[loc];
+    sum2_all += sum2;
 
     // output for each location
-
-    for (auto& i : result2) {
-      i /= sum2;
+    for (auto g_id = 0; g_id < number_of_genotypes; g_id++) {
+      const double number_of_clones = census.number_of_clones_by_location_genotype()[loc][g_id];
+      result2_all[g_id] += number_of_clones;
+      ss << number_of_clones / sum2 << sep;
     }
-    for (auto& i : result2) {
-      ss << i << sep;
-    }
-
   }
   // output for all locations
   ss << group_sep;
@@ -129,55 +70,21 @@ void ReporterUtils::output_genotype_frequency2(
 
 void ReporterUtils::output_genotype_frequency3(
     std::stringstream& ss, const int& number_of_genotypes,
-    PersonIndexByLocationStateAgeClass* pi
+    GenotypeCensus& census
 ) {
   auto sum1_all = 0.0;
   std::vector<double> result3_all(number_of_genotypes, 0.0);
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
+  const auto number_of_locations = census.number_of_infected_hosts_by_location().size();
 
   for (auto loc = 0; loc < number_of_locations; loc++) {
-    std::vector<double> result3(number_of_genotypes, 0.0);
-    auto sum1 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ull; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->all_clonal_parasite_populations()->parasites()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
+    const double sum1 = census.number_of_infected_hosts_by_location()[loc];
+    sum1_all += sum1;
 
-          std::map<int, int> individual_genotype_map;
-
-          for (auto* parasite_population : *(person->all_clonal_parasite_populations()->parasites())) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            if (individual_genotype_map.find(g_id) == individual_genotype_map.end()) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result3[genotype.first] += genotype.second /
-                                       static_cast<double>(person->all_clonal_parasite_populations()
-                                                                 ->parasites()
-                                                                 ->size()
-                                       );
-            result3_all[genotype.first] += genotype.second / static_cast<double>(person
-                ->all_clonal_parasite_populations()->parasites()->size());
-          }
-        }
-      }
-    }
     // output per location
-    for (auto& i : result3) {
-      i /= sum1;
-      ss << i << sep;
+    for (auto g_id = 0; g_id < number_of_genotypes; g_id++) {
+      const auto weighted_number_of_hosts = census.weighted_number_of_hosts(loc, g_id);
+      result3_all[g_id] += weighted_number_of_hosts;
+      ss << weighted_number_of_hosts / sum1 << sep;
     }
   }
 
@@ -194,7 +101,7 @@ void ReporterUtils::output_genotype_frequency3(
 
 void ReporterUtils::output_3_genotype_frequency(
     std::stringstream& ss, const int& number_of_genotypes,
-    PersonIndexByLocationStateAgeClass* pi
+    GenotypeCensus& census
 ) {
   auto sum1_all = 0.0;
   auto sum2_all = 0.0;
@@ -202,73 +109,26 @@ void ReporterUtils::output_3_genotype_frequency(
   std::vector<double> result2_all(number_of_genotypes, 0.0);
   std::vector<double> result3_all(number_of_genotypes, 0.0);
 
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
+  const auto number_of_locations = census.number_of_infected_hosts_by_location().size();
 
   for (auto loc = 0; loc < number_of_locations; loc++) {
-    std::vector<double> result1(number_of_genotypes, 0.0);
-    std::vector<double> result2(number_of_genotypes, 0.0);
-    std::vector<double> result3(number_of_genotypes, 0.0);
-
-    auto sum2 = 0.0;
-    auto sum1 = 0.0;
+    const double sum1 = census.number_of_infected_hosts_by_location()[loc];
+    const double sum2 = census.number_of_clones_by_location()[loc];
+    sum1_all += sum1;
+    sum2_all += sum2;
 
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ull; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->all_clonal_parasite_populations()->parasites()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
-          sum2 += person->all_clonal_parasite_populations()->parasites()->size();
-          sum2_all += sum2;
-          std::map<int, int> individual_genotype_map;
-
-          for (auto* parasite_population : *(person->all_clonal_parasite_populations()->parasites())) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            result2[g_id] += 1;
-            result2_all[g_id] += 1;
-            if (individual_genotype_map.find(g_id) == individual_genotype_map.end()) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result1[genotype.first] += 1;
-            result1_all[genotype.first] += 1;
-            result3[genotype.first] += genotype.second /
-                                       static_cast<double>(person->all_clonal_parasite_populations()
-                                                                 ->parasites()
-                                                                 ->size()
-                                       );
-            result3_all[genotype.first] += genotype.second / static_cast<double>(person
-                ->all_clonal_parasite_populations()->parasites()->size());
-          }
-        }
-      }
-    }
-
-    for (auto& i : result1) {
-      i /= sum1;
-    }
-
-    for (auto& i : result2) {
-      i /= sum2;
-    }
+    for (auto j = 0; j < number_of_genotypes; ++j) {
+      const double number_of_hosts = census.number_of_hosts_by_location_genotype()[loc][j];
+      const double number_of_clones = census.number_of_clones_by_location_genotype()[loc][j];
+      const auto weighted_number_of_hosts = census.weighted_number_of_hosts(loc, j);
 
-    for (auto& i : result3) {
-      i /= sum1;
-    }
+      result1_all[j] += number_of_hosts;
+      result2_all[j] += number_of_clones;
+      result3_all[j] += weighted_number_of_hosts;
 
-    for (auto j = 0; j < number_of_genotypes; ++j) {
-      ss << result1[j] << sep;
-      ss << result2[j] << sep;
-      ss << result3[j] << sep;
+      ss << number_of_hosts / sum1 << sep;
+      ss << number_of_clones / sum2 << sep;
+      ss << weighted_number_of_hosts / sum1 << sep;
     }
 
     ss << group_sep;
@@ -8,7 +8,7 @@
 
 #include <sstream>
 
-class PersonIndexByLocationStateAgeClass;
+class GenotypeCensus;
 
 class ReporterUtils {
 
@@ -17,17 +17,17 @@ public:
     /// individuals
     /// \param ss the output string stream
     /// \param number_of_genotypes total number of genotypes defined in configuration
-    /// \param pi person index by location state and ageclass that obtained from the population object
+    /// \param census genotype census maintained by the model data collector
     static void output_genotype_frequency1(std::stringstream &ss, const int &number_of_genotypes,
-                                           PersonIndexByLocationStateAgeClass* pi);
+                                           GenotypeCensus &census);
 
     /// outputs genotype frequencies by number of clonal parasite populations carrying genotype X / total number of clonal parasite
     ///  populations
     /// \param ss the output string stream
     /// \param number_of_genotypes total number of genotypes defined in configuration
-    /// \param pi person index by location state and ageclass that obtained from the population object
+    /// \param census genotype census maintained by the model data collector
     static void output_genotype_frequency2(std::stringstream &ss, const int &number_of_genotypes,
-                                           PersonIndexByLocationStateAgeClass* pi);
+                                           GenotypeCensus &census);
 
     /// outputs genotype frequencies by the weighted number of parasite-positive individuals carrying genotype X / total number of
     /// parasite-positive individuals (the weights for each person describe the fraction of their clonal
@@ -35,9 +35,9 @@ public:
     /// carry genotype X would be given a weight of 2/5).
     /// \param ss the output string stream
     /// \param number_of_genotypes total number of genotypes defined in configuration
-    /// \param pi person index by location state and ageclass that obtained from the population object
+    /// \param census genotype census maintained by the model data collector
     static void output_genotype_frequency3(std::stringstream &ss, const int &number_of_genotypes,
-                                           PersonIndexByLocationStateAgeClass* pi);
+                                           GenotypeCensus &census);
 
     /// \brief outputs genotype frequencies by all 3 methods:
     /// \details
@@ -51,9 +51,9 @@ public:
     ///     carry genotype X would be given a weight of 2/5).
     /// \param ss the output string stream
     /// \param number_of_genotypes total number of genotypes defined in configuration
-    /// \param pi person index by location state and ageclass that obtained from the population object
+    /// \param census genotype census maintained by the model data collector
     static void output_3_genotype_frequency(std::stringstream &ss, const int &number_of_genotypes,
-                                            PersonIndexByLocationStateAgeClass* pi);
+                                            GenotypeCensus &census);
 };
 
 
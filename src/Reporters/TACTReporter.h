@@ -10,7 +10,7 @@
 #include <sstream>
 #include "Reporter.h"
 
-class PersonIndexByLocationStateAgeClass;
+class GenotypeCensus;
 
 class TACTReporter : public Reporter {
 DISALLOW_COPY_AND_ASSIGN(TACTReporter)
@@ -36,7 +36,7 @@ public:
 private:
   void output_genotype_frequency_3(
       const int& number_of_genotypes,
-      PersonIndexByLocationStateAgeClass* pi
+      GenotypeCensus& census
   );
 
 public:
@@ -4,7 +4,6 @@
 
 #include <cmath>
 #include "BarabasiSM.h"
-#include "Helpers/NumberHelpers.h"
 
 namespace Spatial {
 
@@ -16,22 +15,15 @@ namespace Spatial {
 
   BarabasiSM::~BarabasiSM() = default;
 
-  DoubleVector
-  BarabasiSM::get_v_relative_out_movement_to_destination(const int &from_location, const int &number_of_locations,
-                                                         const DoubleVector &relative_distance_vector,
-                                                         const IntVector &v_number_of_residents_by_location) const {
-    DoubleVector v_relative_number_of_circulation_by_location(number_of_locations, 0);
+  double BarabasiSM::get_distance_factor(const double &distance) const {
+    return pow((distance + r_g_0_), -beta_r_)*exp(-r_g_0_/kappa_);   // equation from Barabasi's paper
+  }
 
-    for (int target_location = 0; target_location < number_of_locations; target_location++) {
-      if (NumberHelpers::is_equal(relative_distance_vector[target_location], 0.0)) {
-        v_relative_number_of_circulation_by_location[target_location] = 0;
-      } else {
-        v_relative_number_of_circulation_by_location[target_location] =
-            pow((relative_distance_vector[target_location] + r_g_0_), -beta_r_)*
-                exp(-r_g_0_/kappa_);   // equation from Barabasi's paper
-      }
-    }
+  double BarabasiSM::get_origin_factor(const int &number_of_residents) const {
+    return 1.0;
+  }
 
-    return v_relative_number_of_circulation_by_location;
+  double BarabasiSM::get_destination_factor(const int &number_of_residents) const {
+    return 1.0;
   }
 }
\ No newline at end of file
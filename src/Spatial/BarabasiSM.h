@@ -24,9 +24,11 @@ class BarabasiSM : public SpatialModel {
 
   virtual ~ BarabasiSM();
 
-  DoubleVector get_v_relative_out_movement_to_destination(const int &from_location, const int &number_of_locations,
-                                                          const DoubleVector &relative_distance_vector,
-                                                          const IntVector &v_number_of_residents_by_location) const override;
+  double get_distance_factor(const double &distance) const override;
+
+  double get_origin_factor(const int &number_of_residents) const override;
+
+  double get_destination_factor(const int &number_of_residents) const override;
 
 };
 }
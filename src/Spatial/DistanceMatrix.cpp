@@ -0,0 +1,143 @@
+//
+// DistanceMatrix.cpp
+//
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include "DistanceMatrix.h"
+
+namespace Spatial {
+
+const int DistanceMatrix::ROWS_PER_BLOCK;
+const std::size_t DistanceMatrix::MIN_DISTANCES_FOR_PARALLEL_BLOCK;
+
+DistanceMatrix::DistanceMatrix() : cutoff_in_km_(0) {}
+
+DistanceMatrix::~DistanceMatrix() = default;
+
+void DistanceMatrix::initialize(const std::vector<Location> &locations, const double &cutoff_in_km) {
+  cutoff_in_km_ = cutoff_in_km;
+  coordinates_.clear();
+  for (const auto &location : locations) {
+    coordinates_.emplace_back(new Coordinate(location.coordinate->latitude, location.coordinate->longitude));
+  }
+  rows_.clear();
+  rows_.resize(locations.size());
+}
+
+int DistanceMatrix::number_of_locations() const {
+  return static_cast<int>(coordinates_.size());
+}
+
+const DistanceMatrix::Row &DistanceMatrix::row(const int &from_location) const {
+  if (!rows_[from_location].computed) {
+    const auto block_start = (from_location / ROWS_PER_BLOCK) * ROWS_PER_BLOCK;
+    compute_rows(block_start, std::min(block_start + ROWS_PER_BLOCK, number_of_locations()));
+  }
+  return rows_[from_location];
+}
+
+double DistanceMatrix::distance(const int &from_location, const int &to_location) const {
+  const auto &r = row(from_location);
+  if (cutoff_in_km_ <= 0) {
+    return r.distances[to_location];
+  }
+  const auto it = std::lower_bound(r.locations.begin(), r.locations.end(), to_location);
+  if (it == r.locations.end() || *it != to_location) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return r.distances[it - r.locations.begin()];
+}
+
+void DistanceMatrix::set_row(const int &from_location, const DoubleVector &distances) {
+  auto &r = rows_[from_location];
+  r.locations.clear();
+  r.distances.clear();
+  for (auto to_location = 0; to_location < static_cast<int>(distances.size()); to_location++) {
+    if (cutoff_in_km_ > 0) {
+      if (distances[to_location] > cutoff_in_km_) continue;
+      r.locations.push_back(to_location);
+    }
+    r.distances.push_back(static_cast<float>(distances[to_location]));
+  }
+  r.computed = true;
+}
+
+void DistanceMatrix::set_row(const int &from_location, std::vector<int> locations, std::vector<float> distances) {
+  auto &r = rows_[from_location];
+  r.locations = std::move(locations);
+  r.distances = std::move(distances);
+  r.computed = true;
+}
+
+void DistanceMatrix::compute_all() const {
+  for (auto block_start = 0; block_start < number_of_locations(); block_start += ROWS_PER_BLOCK) {
+    compute_rows(block_start, std::min(block_start + ROWS_PER_BLOCK, number_of_locations()));
+  }
+}
+
+int DistanceMatrix::number_of_computed_rows() const {
+  return static_cast<int>(std::count_if(rows_.begin(), rows_.end(), [](const Row &r) { return r.computed; }));
+}
+
+DoubleVector2 DistanceMatrix::to_dense() const {
+  DoubleVector2 result(number_of_locations(), DoubleVector(number_of_locations()));
+  for (auto from_location = 0; from_location < number_of_locations(); from_location++) {
+    for (auto to_location = 0; to_location < number_of_locations(); to_location++) {
+      result[from_location][to_location] = distance(from_location, to_location);
+    }
+  }
+  return result;
+}
+
+void DistanceMatrix::compute_rows(const int &from, const int &to) const {
+  std::vector<int> pending;
+  for (auto from_location = from; from_location < to; from_location++) {
+    if (!rows_[from_location].computed) {
+      pending.push_back(from_location);
+    }
+  }
+
+  const auto number_of_threads = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                                       pending.size());
+  if (number_of_threads <= 1 || pending.size() * coordinates_.size() < MIN_DISTANCES_FOR_PARALLEL_BLOCK) {
+    for (auto from_location : pending) {
+      compute_row(from_location);
+    }
+    return;
+  }
+
+  // every thread fills its own rows, so no synchronization is needed besides the join
+  std::vector<std::thread> threads;
+  for (auto t = 0ul; t < number_of_threads; t++) {
+    threads.emplace_back([this, &pending, t, number_of_threads]() {
+      for (auto i = t; i < pending.size(); i += number_of_threads) {
+        compute_row(pending[i]);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+void DistanceMatrix::compute_row(const int &from_location) const {
+  auto &r = rows_[from_location];
+  r.locations.clear();
+  r.distances.clear();
+  if (cutoff_in_km_ <= 0) {
+    r.distances.reserve(coordinates_.size());
+  }
+
+  for (auto to_location = 0; to_location < number_of_locations(); to_location++) {
+    const auto d = Coordinate::calculate_distance_in_km(*coordinates_[from_location], *coordinates_[to_location]);
+    if (cutoff_in_km_ > 0) {
+      if (d > cutoff_in_km_) continue;
+      r.locations.push_back(to_location);
+    }
+    r.distances.push_back(static_cast<float>(d));
+  }
+  r.computed = true;
+}
+}
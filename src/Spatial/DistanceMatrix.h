@@ -0,0 +1,94 @@
+//
+// DistanceMatrix.h
+//
+
+#ifndef SPATIAL_DISTANCEMATRIX_H
+#define SPATIAL_DISTANCEMATRIX_H
+
+#include <memory>
+#include <vector>
+#include "Core/PropertyMacro.h"
+#include "Core/TypeDef.h"
+#include "Coordinate.h"
+#include "Location.h"
+
+namespace Spatial {
+
+/*!
+ *  DistanceMatrix gives the distance in km between every pair of locations. Rows are only computed when they are first
+ *  asked for, a block of ROWS_PER_BLOCK rows at a time, and a large block is split over the hardware threads. Distances
+ *  are stored as float, and when a cutoff is given a row only keeps the destinations within the cutoff radius, so that
+ *  pixel level configurations do not need a dense number_of_locations^2 matrix of doubles.
+ *
+ *  The matrix is filled lazily from const accessors but is not meant to be read from several threads at once.
+ */
+class DistanceMatrix {
+ DISALLOW_COPY_AND_ASSIGN(DistanceMatrix)
+
+ DISALLOW_MOVE(DistanceMatrix)
+
+ READ_ONLY_PROPERTY_REF(double, cutoff_in_km)
+
+ public:
+  /// destinations of one origin, either every location in order (dense) or only those within the cutoff (sparse)
+  struct Row {
+    // empty when the row is dense
+    std::vector<int> locations;
+    std::vector<float> distances;
+    bool computed{false};
+
+    std::size_t size() const {
+      return distances.size();
+    }
+
+    int location(const std::size_t &index) const {
+      return locations.empty() ? static_cast<int>(index) : locations[index];
+    }
+  };
+
+  static const int ROWS_PER_BLOCK = 64;
+
+  // blocks with fewer distances than this are computed on the calling thread
+  static const std::size_t MIN_DISTANCES_FOR_PARALLEL_BLOCK = 1 << 16;
+
+ public:
+  DistanceMatrix();
+
+  virtual ~DistanceMatrix();
+
+  /// a cutoff of 0 keeps every destination
+  void initialize(const std::vector<Location> &locations, const double &cutoff_in_km = 0);
+
+  int number_of_locations() const;
+
+  const Row &row(const int &from_location) const;
+
+  /// distance in km, infinity when the pair is beyond the cutoff
+  double distance(const int &from_location, const int &to_location) const;
+
+  /// replaces a row by given distances, entries beyond the cutoff are dropped
+  void set_row(const int &from_location, const DoubleVector &distances);
+
+  /// replaces a row by one as kept in memory, locations are empty when the matrix has no cutoff
+  void set_row(const int &from_location, std::vector<int> locations, std::vector<float> distances);
+
+  /// computes every row that has not been computed yet
+  void compute_all() const;
+
+  int number_of_computed_rows() const;
+
+  /// dense copy of the matrix (infinity beyond the cutoff), mostly for tests
+  DoubleVector2 to_dense() const;
+
+ private:
+  void compute_rows(const int &from, const int &to) const;
+
+  void compute_row(const int &from_location) const;
+
+  std::vector<std::unique_ptr<Coordinate>> coordinates_;
+
+  mutable std::vector<Row> rows_;
+};
+}
+
+#endif //SPATIAL_DISTANCEMATRIX_H
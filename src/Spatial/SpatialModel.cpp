@@ -3,6 +3,7 @@
 //
 
 #include "SpatialModel.h"
+#include "Helpers/NumberHelpers.h"
 
 namespace Spatial {
 SpatialModel::SpatialModel() {
@@ -12,4 +13,96 @@ SpatialModel::SpatialModel() {
 SpatialModel::~SpatialModel() {
 
 }
-}
\ No newline at end of file
+
+void SpatialModel::update_residents(const IntVector &v_number_of_residents_by_location, const int &residents_version) {
+  if (residents_version==residents_version_) return;
+
+  origin_factors_.resize(v_number_of_residents_by_location.size());
+  destination_factors_.resize(v_number_of_residents_by_location.size());
+  for (auto location = 0ul; location < v_number_of_residents_by_location.size(); location++) {
+    origin_factors_[location] = get_origin_factor(v_number_of_residents_by_location[location]);
+    destination_factors_[location] = get_destination_factor(v_number_of_residents_by_location[location]);
+  }
+  residents_version_ = residents_version;
+  population_version_++;
+}
+
+const double *SpatialModel::get_v_relative_out_movement_to_destination(const int &from_location,
+                                                                       const DistanceMatrix &distances) {
+  if (offsets_.size() != static_cast<std::size_t>(distances.number_of_locations())) {
+    clear_cache();
+    offsets_.assign(distances.number_of_locations(), -1);
+    origin_versions_.assign(distances.number_of_locations(), -1);
+  }
+
+  const auto &row = distances.row(from_location);
+  if (offsets_[from_location] < 0) {
+    offsets_[from_location] = static_cast<long>(distance_factors_.size());
+    for (auto i = 0ul; i < row.size(); i++) {
+      const double distance = row.distances[i];
+      distance_factors_.push_back(NumberHelpers::is_equal(distance, 0.0) ? 0 : get_distance_factor(distance));
+    }
+    relative_out_movements_.resize(distance_factors_.size());
+  }
+
+  const auto offset = offsets_[from_location];
+  if (origin_versions_[from_location] != population_version_) {
+    const auto origin_factor = origin_factors_[from_location];
+    for (auto i = 0ul; i < row.size(); i++) {
+      relative_out_movements_[offset + i] =
+          distance_factors_[offset + i]*origin_factor*destination_factors_[row.location(i)];
+    }
+    origin_versions_[from_location] = population_version_;
+  }
+
+  return &relative_out_movements_[offset];
+}
+
+const SpatialModel::DestinationSampler &
+SpatialModel::get_destination_sampler(const int &from_location, const DistanceMatrix &distances,
+                                      const double &min_relative_weight) {
+  if (destination_samplers_.size()!=static_cast<std::size_t>(distances.number_of_locations())) {
+    destination_samplers_.clear();
+    destination_samplers_.resize(distances.number_of_locations());
+  }
+
+  auto &sampler = destination_samplers_[from_location];
+  if (sampler.version==population_version_) {
+    return sampler;
+  }
+
+  // the weights are evaluated straight from the distance row, only the kept destinations are stored
+  const auto &row = distances.row(from_location);
+  const auto origin_factor = origin_factors_[from_location];
+  row_weights_.resize(row.size());
+  auto total = 0.0;
+  for (auto i = 0ul; i < row.size(); i++) {
+    const double distance = row.distances[i];
+    row_weights_[i] = NumberHelpers::is_equal(distance, 0.0)
+                      ? 0
+                      : get_distance_factor(distance)*origin_factor*destination_factors_[row.location(i)];
+    total += row_weights_[i];
+  }
+
+  sampler.locations.clear();
+  kept_weights_.clear();
+  for (auto i = 0ul; i < row.size(); i++) {
+    if (row_weights_[i] > 0 && row_weights_[i] > min_relative_weight*total) {
+      sampler.locations.push_back(row.location(i));
+      kept_weights_.push_back(row_weights_[i]);
+    }
+  }
+  sampler.table.build(kept_weights_);
+  sampler.version = population_version_;
+  return sampler;
+}
+
+void SpatialModel::clear_cache() {
+  offsets_.clear();
+  destination_samplers_.clear();
+  origin_versions_.clear();
+  distance_factors_.clear();
+  relative_out_movements_.clear();
+  population_version_++;
+}
+}
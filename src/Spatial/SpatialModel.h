@@ -7,21 +7,98 @@
 
 #include "Core/PropertyMacro.h"
 #include "Core/TypeDef.h"
+#include "Core/AliasTable.h"
+#include "DistanceMatrix.h"
 
 namespace Spatial {
+/*!
+ *  A spatial model gives the relative movement from an origin to every destination as a separable kernel
+ *      distance_factor(distance) * origin_factor(residents of origin) * destination_factor(residents of destination)
+ *  and 0 to the origin itself.
+ *
+ *  The distance factors of an origin are evaluated once, the first time the origin is used, and kept in one flat
+ *  buffer in the order of its distance row. The population factors are only recomputed by update_residents() when the
+ *  version of the number of residents has changed, and the relative movements of an origin are only recombined with
+ *  them when that origin is used after such a change, so a lookup costs one integer comparison otherwise.
+ *
+ *  For the sparse movement mode, an alias table over the non-negligible destinations of an origin is built straight
+ *  from its distance row (only the destinations within the cutoff when the matrix has one) and rebuilt when the
+ *  population factors change. The distance factors are evaluated again at each rebuild rather than cached, so this
+ *  mode never fills the per-origin buffers above and keeps only the sampled destinations of each origin.
+ */
 class SpatialModel {
  DISALLOW_COPY_AND_ASSIGN(SpatialModel)
 
+ public:
+  /// destination table.sample() of an origin is locations[table.sample()]
+  struct DestinationSampler {
+    AliasTable table;
+    std::vector<int> locations;
+    int version{-1};
+  };
+
  public:
   SpatialModel();
 
   virtual ~SpatialModel();
 
-  virtual DoubleVector
-  get_v_relative_out_movement_to_destination(const int &from_location, const int &number_of_locations,
-                                             const DoubleVector &relative_distance_vector,
-                                             const IntVector &v_number_of_residents_by_location) const = 0;;
+  virtual double get_distance_factor(const double &distance) const = 0;
+
+  virtual double get_origin_factor(const int &number_of_residents) const = 0;
+
+  virtual double get_destination_factor(const int &number_of_residents) const = 0;
+
+  /**
+   * Sets the number of residents by location used by the population factors. They are only recomputed when
+   * residents_version differs from the version of the last call, the caller bumps it whenever the residents change
+   * (see ModelDataCollector::popsize_residence_by_location_version).
+   */
+  void update_residents(const IntVector &v_number_of_residents_by_location, const int &residents_version);
+
+  /**
+   * Relative movement from from_location to the destinations of distances.row(from_location), in the order of that
+   * row, for the residents of the last update_residents(). The returned buffer stays valid until the next call.
+   */
+  const double *get_v_relative_out_movement_to_destination(const int &from_location,
+                                                           const DistanceMatrix &distances);
+
+  /**
+   * Sampler over the destinations of from_location whose relative movement is more than min_relative_weight of the
+   * total relative movement out of from_location (every destination with a positive weight when it is 0).
+   */
+  const DestinationSampler &get_destination_sampler(const int &from_location, const DistanceMatrix &distances,
+                                                    const double &min_relative_weight);
+
+  /// forgets every cached kernel, e.g. after the distance matrix was rebuilt
+  void clear_cache();
+
+ private:
+  // start of each origin in the flat buffers, -1 until the origin is first used
+  std::vector<long> offsets_;
+
+  DoubleVector distance_factors_;
+
+  DoubleVector relative_out_movements_;
+
+  // version of the population factors each origin was last recombined with
+  std::vector<int> origin_versions_;
+
+  // version given by the caller for the residents the population factors were computed with
+  int residents_version_{-1};
+
+  // incremented whenever the population factors are recomputed or the cache is cleared
+  int population_version_{0};
+
+  DoubleVector origin_factors_;
+
+  DoubleVector destination_factors_;
+
+  std::vector<DestinationSampler> destination_samplers_;
+
+  // weights of the distance row of the sampler being rebuilt
+  DoubleVector row_weights_;
 
+  DoubleVector kept_weights_;
 };
 }
 
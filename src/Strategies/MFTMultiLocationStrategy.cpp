@@ -5,6 +5,7 @@
 #include <sstream>
 #include "MFTMultiLocationStrategy.h"
 #include "Therapies/Therapy.h"
+#include <algorithm>
 #include "Model.h"
 #include "Core/Random.h"
 #include "Population/Person.h"
@@ -20,19 +21,23 @@ void MFTMultiLocationStrategy::add_therapy(Therapy *therapy) {
 }
 
 Therapy *MFTMultiLocationStrategy::get_therapy(Person *person) {
+  if (distribution_tables.size() != distribution.size()) {
+    update_distribution_table();
+  }
 
   const auto p = Model::RANDOM->random_flat(0.0, 1.0);
   const auto loc = person->location();
 
-  double sum = 0;
-  for (auto i = 0; i < distribution[loc].size(); i++) {
-    sum += distribution[loc][i];
-    if (p <= sum) {
-      return therapy_list[i];
-    }
-  }
+  // past the last weight the scan falls back to the last one
+  const auto i = std::min(distribution_tables[loc].index(p), therapy_list.size() - 1);
+  return therapy_list[i];
+}
 
-  return therapy_list[therapy_list.size() - 1];
+void MFTMultiLocationStrategy::update_distribution_table() {
+  distribution_tables.resize(distribution.size());
+  for (auto loc = 0ul; loc < distribution.size(); loc++) {
+    distribution_tables[loc].build(distribution[loc]);
+  }
 }
 
 std::string MFTMultiLocationStrategy::to_string() const {
@@ -91,4 +96,5 @@ void MFTMultiLocationStrategy::monthly_update() {
       }
     }
   }
+  update_distribution_table();
 }
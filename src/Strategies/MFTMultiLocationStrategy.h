@@ -6,6 +6,7 @@
 #define POMS_MFTDIFFERENTDISTRIBUTIONBYLOCATIONSTRATEGY_H
 
 #include "IStrategy.h"
+#include "Core/GuideTable.h"
 #include "Core/TypeDef.h"
 
 class MFTMultiLocationStrategy : public IStrategy {
@@ -17,6 +18,8 @@ class MFTMultiLocationStrategy : public IStrategy {
   std::vector<Therapy *> therapy_list;
   // DoubleVector2 distribution_by_location;
   DoubleVector2 distribution;
+  // compiled distribution of every location, rebuilt by update_distribution_table() whenever distribution changes
+  std::vector<GuideTable> distribution_tables;
   DoubleVector2 start_distribution;
   DoubleVector2 peak_distribution;
   int starting_time{0};
@@ -31,6 +34,8 @@ class MFTMultiLocationStrategy : public IStrategy {
 
   Therapy *get_therapy(Person *person) override;
 
+  void update_distribution_table();
+
   std::string to_string() const override;
 
   void update_end_of_time_step() override;
@@ -49,6 +49,7 @@ void MFTRebalancingStrategy::update_end_of_time_step() {
     for (auto i = 0; i < distribution.size(); i++) {
       distribution[i] = next_distribution[i];
     }
+    update_distribution_table();
     next_update_time = Model::SCHEDULER->current_time() + update_duration_after_rebalancing;
     LOG(INFO) << date::year_month_day{Model::SCHEDULER->calendar_date} << ": MFT Rebalancing adjust distribution: "
               << to_string();
@@ -9,6 +9,7 @@
 #define MFTSTRATEGY_H
 
 #include "IStrategy.h"
+#include "Core/GuideTable.h"
 #include "Core/PropertyMacro.h"
 
 class Random;
@@ -23,6 +24,8 @@ class MFTStrategy : public IStrategy {
  public:
   std::vector<Therapy *> therapy_list;
   std::vector<double> distribution;
+  // compiled distribution, rebuilt by update_distribution_table() whenever distribution changes
+  GuideTable distribution_table;
 
   MFTStrategy();
 
@@ -33,6 +36,8 @@ class MFTStrategy : public IStrategy {
 
   Therapy *get_therapy(Person *person) override;
 
+  void update_distribution_table();
+
   void update_end_of_time_step() override;
 
   std::string to_string() const override;
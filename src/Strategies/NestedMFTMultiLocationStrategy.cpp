@@ -10,6 +10,7 @@
 #include "Population/Person.h"
 #include "Core/Scheduler.h"
 #include "Therapies/Therapy.h"
+#include <algorithm>
 
 
 
@@ -25,17 +26,23 @@ void NestedMFTMultiLocationStrategy::add_strategy(IStrategy *strategy) {
 void NestedMFTMultiLocationStrategy::add_therapy(Therapy *therapy) {}
 
 Therapy *NestedMFTMultiLocationStrategy::get_therapy(Person *person) {
+  if (distribution_tables.size() != distribution.size()) {
+    update_distribution_table();
+  }
+
   const auto loc = person->location();
   const auto p = Model::RANDOM->random_flat(0.0, 1.0);
 
-  double sum = 0;
-  for (auto i = 0; i < distribution[loc].size(); i++) {
-    sum += distribution[loc][i];
-    if (p <= sum) {
-      return strategy_list[i]->get_therapy(person);
-    }
+  // past the last weight the scan falls back to the last one
+  const auto i = std::min(distribution_tables[loc].index(p), strategy_list.size() - 1);
+  return strategy_list[i]->get_therapy(person);
+}
+
+void NestedMFTMultiLocationStrategy::update_distribution_table() {
+  distribution_tables.resize(distribution.size());
+  for (auto loc = 0ul; loc < distribution.size(); loc++) {
+    distribution_tables[loc].build(distribution[loc]);
   }
-  return strategy_list[strategy_list.size() - 1]->get_therapy(person);
 }
 
 std::string NestedMFTMultiLocationStrategy::to_string() const {
@@ -88,6 +95,7 @@ void NestedMFTMultiLocationStrategy::adjust_distribution(const int &time) {
       }
     }
   } //    std::cout << to_string() << std::endl;
+  update_distribution_table();
 }
 
 void NestedMFTMultiLocationStrategy::adjust_started_time_point(const int &current_time) {
@@ -6,6 +6,7 @@
 #define POMS_NESTEDSWITCHINGDIFFERENTDISTRIBUTIONBYLOCATION_H
 
 #include "IStrategy.h"
+#include "Core/GuideTable.h"
 #include "Core/TypeDef.h"
 
 class Config;
@@ -18,6 +19,8 @@ class NestedMFTMultiLocationStrategy : public IStrategy {
  public:
   std::vector<IStrategy *> strategy_list;
   DoubleVector2 distribution;
+  // compiled distribution of every location, rebuilt by update_distribution_table() whenever distribution changes
+  std::vector<GuideTable> distribution_tables;
   DoubleVector2 start_distribution;
   DoubleVector2 peak_distribution;
   int starting_time{0};
@@ -34,6 +37,8 @@ class NestedMFTMultiLocationStrategy : public IStrategy {
 
   Therapy *get_therapy(Person *person) override;
 
+  void update_distribution_table();
+
   std::string to_string() const override;
 
   /**
@@ -3,6 +3,7 @@
 #include "Core/Config/Config.h"
 #include "Core/Random.h"
 #include "Therapies/Therapy.h"
+#include <algorithm>
 
 void NestedMFTStrategy::add_strategy(IStrategy* strategy) {
   strategy_list.push_back(strategy);
@@ -11,16 +12,18 @@ void NestedMFTStrategy::add_strategy(IStrategy* strategy) {
 void NestedMFTStrategy::add_therapy(Therapy* therapy) { }
 
 Therapy* NestedMFTStrategy::get_therapy(Person* person) {
+  if (distribution_table.size() != distribution.size()) {
+    update_distribution_table();
+  }
   const auto p = Model::RANDOM->random_flat(0.0, 1.0);
 
-  double sum = 0;
-  for (auto i = 0; i < distribution.size(); i++) {
-    sum += distribution[i];
-    if (p <= sum) {
-      return strategy_list[i]->get_therapy(person);
-    }
-  }
-  return strategy_list[strategy_list.size() - 1]->get_therapy(person);
+  // past the last weight the scan falls back to the last one
+  const auto i = std::min(distribution_table.index(p), strategy_list.size() - 1);
+  return strategy_list[i]->get_therapy(person);
+}
+
+void NestedMFTStrategy::update_distribution_table() {
+  distribution_table.build(distribution);
 }
 
 std::string NestedMFTStrategy::to_string() const {
@@ -71,4 +74,5 @@ void NestedMFTStrategy::adjust_distribution(const int& time) {
       }
     }
   }
+  update_distribution_table();
 }
@@ -2,6 +2,7 @@
 #define NESTEDMFTSTRATEGY_H
 
 #include "IStrategy.h"
+#include "Core/GuideTable.h"
 
 class NestedMFTStrategy : public IStrategy {
  DISALLOW_COPY_AND_ASSIGN(NestedMFTStrategy)
@@ -11,6 +12,8 @@ class NestedMFTStrategy : public IStrategy {
  public:
   std::vector<IStrategy *> strategy_list;
   std::vector<double> distribution;
+  // compiled distribution, rebuilt by update_distribution_table() whenever distribution changes
+  GuideTable distribution_table;
   std::vector<double> start_distribution;
   std::vector<double> peak_distribution;
   int starting_time{0};
@@ -27,6 +30,8 @@ class NestedMFTStrategy : public IStrategy {
 
   Therapy *get_therapy(Person *person) override;
 
+  void update_distribution_table();
+
   std::string to_string() const override;
 
   void adjust_started_time_point(const int &current_time) override;
@@ -2,6 +2,7 @@
 #include "Model.h"
 #include "Core/Random.h"
 #include "Therapies/Therapy.h"
+#include <algorithm>
 #include "MDC/ModelDataCollector.h"
 #include "Core/Config/Config.h"
 #include "Helpers/TimeHelpers.h"
@@ -15,17 +16,18 @@ void NovelDrugSwitchingStrategy::add_therapy(Therapy *therapy) {
 }
 
 Therapy *NovelDrugSwitchingStrategy::get_therapy(Person *person) {
+  if (distribution_table.size() != distribution.size()) {
+    update_distribution_table();
+  }
   const auto p = Model::RANDOM->random_flat(0.0, 1.0);
 
-  double sum = 0;
-  for (auto i = 0; i < distribution.size(); i++) {
-    sum += distribution[i];
-    if (p <= sum) {
-      return therapy_list[i];
-    }
-  }
+  // past the last weight the scan falls back to the last one
+  const auto i = std::min(distribution_table.index(p), therapy_list.size() - 1);
+  return therapy_list[i];
+}
 
-  return therapy_list[therapy_list.size() - 1];
+void NovelDrugSwitchingStrategy::update_distribution_table() {
+  distribution_table.build(distribution);
 }
 
 std::string NovelDrugSwitchingStrategy::to_string() const {
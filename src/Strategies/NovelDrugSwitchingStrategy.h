@@ -3,6 +3,7 @@
 
 #include <vector>
 #include "IStrategy.h"
+#include "Core/GuideTable.h"
 #include "Core/PropertyMacro.h"
 
 class NovelDrugSwitchingStrategy : public IStrategy {
@@ -13,6 +14,8 @@ class NovelDrugSwitchingStrategy : public IStrategy {
  public:
   std::vector<Therapy *> therapy_list;
   std::vector<double> distribution;
+  // compiled distribution, rebuilt by update_distribution_table() whenever distribution changes
+  GuideTable distribution_table;
 
   int switch_to{0};
   double tf_threshold{0.1};
@@ -25,6 +28,8 @@ class NovelDrugSwitchingStrategy : public IStrategy {
 
   Therapy *get_therapy(Person *person) override;
 
+  void update_distribution_table();
+
   std::string to_string() const override;
 
   void update_end_of_time_step() override;
@@ -13,32 +13,100 @@
 #include "Core/Scheduler.h"
 #include "Core/Config/Config.h"
 #include "Helpers/NumberHelpers.h"
+#include "Population/DrugsInBlood.h"
+#include <algorithm>
 #include <cmath>
 
-OBJECTPOOL_IMPL(Drug)
-
-Drug::Drug(DrugType *drug_type) : dosing_days_(0), start_time_(0), end_time_(0), last_update_value_(1.0),
-                                  last_update_time_(0), starting_value_(1.0), drug_type_(drug_type),
-                                  person_drugs_(nullptr) {}
+Drug::Drug(DrugType *drug_type) : dosing_days_(0), start_time_(0), end_time_(0), last_update_time_(0),
+                                  drug_type_id_(drug_type == nullptr ? -1 : drug_type->id()),
+                                  is_last_update_value_pending_(false), last_update_value_(1.0), starting_value_(1.0) {}
 
 Drug::~Drug() = default;
 
+DrugType *Drug::drug_type() const {
+  return Model::CONFIG->drug_db()->at(drug_type_id_);
+}
+
 void Drug::update() {
-  const auto current_time = Model::SCHEDULER->current_time();
-  last_update_value_ = get_current_drug_concentration(current_time);
+  update(Model::SCHEDULER->current_time(), *Model::CONFIG, *Model::RANDOM);
+}
+
+void Drug::update(const int &current_time, Config &config, Random &random) {
+  auto *drug_type = config.drug_db()->at(drug_type_id_);
+  if (config.using_lazy_drug_concentration() && current_time - start_time_ > dosing_days_) {
+    // decay phase: no random draws, the concentration is only evaluated if something reads it
+    if (last_update_time_ - start_time_ <= dosing_days_) {
+      // first update of the decay phase, starting_value_ is final
+      end_time_ = start_time_ + get_cut_off_days(drug_type);
+    }
+    is_last_update_value_pending_ = true;
+    last_update_time_ = current_time;
+    return;
+  }
+  last_update_value_ = get_current_drug_concentration(current_time, drug_type, random);
+  is_last_update_value_pending_ = false;
   last_update_time_ = current_time;
 }
 
+double Drug::last_update_value() const {
+  return last_update_value(*Model::CONFIG);
+}
+
+double Drug::last_update_value(Config &config) const {
+  if (is_last_update_value_pending_) {
+    last_update_value_ = get_decay_drug_concentration(config.drug_db()->at(drug_type_id_), starting_value_,
+                                                      dosing_days_, last_update_time_ - start_time_);
+    is_last_update_value_pending_ = false;
+  }
+  return last_update_value_;
+}
+
+void Drug::set_last_update_value(const double &value) {
+  last_update_value_ = value;
+  is_last_update_value_pending_ = false;
+}
+
+bool Drug::is_cut_off() const {
+  if (is_last_update_value_pending_) {
+    return last_update_time_ >= end_time_;
+  }
+  return last_update_value_ <= DRUG_CUT_OFF_VALUE;
+}
+
+int Drug::get_cut_off_days(DrugType *drug_type) const {
+  const auto first_decay_day = dosing_days_ + 1;
+  if (starting_value_ <= DRUG_CUT_OFF_VALUE || NumberHelpers::is_equal(drug_type->drug_half_life(), 0.0)) {
+    return first_decay_day;
+  }
+  // the decay is at or below the cut-off once exp(temp) <= max(0.1, DRUG_CUT_OFF_VALUE / starting_value_), the
+  // estimate is then moved to the exact day by the same evaluation as get_decay_drug_concentration
+  const auto factor = std::max(10.0/100.0, DRUG_CUT_OFF_VALUE/starting_value_);
+  auto days = std::max(first_decay_day,
+                       dosing_days_ + static_cast<int>(std::ceil(-log(factor)*drug_type->drug_half_life()/log(2))));
+  while (days > first_decay_day
+      && get_decay_drug_concentration(drug_type, starting_value_, dosing_days_, days - 1) <= DRUG_CUT_OFF_VALUE) {
+    days--;
+  }
+  while (get_decay_drug_concentration(drug_type, starting_value_, dosing_days_, days) > DRUG_CUT_OFF_VALUE) {
+    days++;
+  }
+  return days;
+}
+
 double Drug::get_current_drug_concentration(int currentTime) {
-  const auto days = currentTime - start_time_;
+  return get_current_drug_concentration(currentTime, drug_type(), *Model::RANDOM);
+}
+
+double Drug::get_current_drug_concentration(const int &current_time, DrugType *drug_type, Random &random) {
+  const auto days = current_time - start_time_;
   if (days==0) {
     return 0;
   }
 
   if (days <= dosing_days_) {
-    if (drug_type()->id()==0) {
+    if (drug_type_id_==0) {
       //drug is artemisinin
-      return starting_value_ + Model::RANDOM->random_uniform_double(-0.2, 0.2);
+      return starting_value_ + random.random_uniform_double(-0.2, 0.2);
 //       return  Model::RANDOM->random_normal(starting_value_, Model::CONFIG->as_iov());
 
       // starting_value_ += Model::RANDOM->random_uniform_double(0, 0.2);
@@ -46,57 +114,66 @@ double Drug::get_current_drug_concentration(int currentTime) {
       //            return starting_value_;
     }
 
-    starting_value_ += Model::RANDOM->random_uniform_double(0, 0.1);
+    starting_value_ += random.random_uniform_double(0, 0.1);
     //        return starting_value_ + Model::RANDOM->random_uniform_double(-0.1, 0.1);
     return starting_value_;
-  } else {
-    const auto temp = NumberHelpers::is_equal(drug_type_->drug_half_life(), 0.0)
-                      ? -100
-                      : -(days - dosing_days_)*
-            log(2)/
-            drug_type_->drug_half_life(); //-ai*t = - t* ln2 / tstar
-    if (exp(temp) <= (10.0/100.0)) {
-      return 0;
-    }
-    return starting_value_*exp(temp);
   }
+  return get_decay_drug_concentration(drug_type, starting_value_, dosing_days_, days);
+}
+
+double Drug::get_decay_drug_concentration(const int &days) const {
+  return get_decay_drug_concentration(drug_type(), starting_value_, dosing_days_, days);
+}
+
+double Drug::get_decay_drug_concentration(DrugType *drug_type, const double &starting_value, const int &dosing_days,
+                                          const int &days) {
+  const auto half_life = drug_type->drug_half_life();
+  const auto temp = NumberHelpers::is_equal(half_life, 0.0)
+                    ? -100
+                    : -(days - dosing_days)*
+          log(2)/
+          half_life; //-ai*t = - t* ln2 / tstar
+  if (exp(temp) <= (10.0/100.0)) {
+    return 0;
+  }
+  return starting_value*exp(temp);
 }
 
 double Drug::get_mutation_probability(double currentDrugConcentration) const {
   double P = 0;
   if (currentDrugConcentration <= 0)
     return 0;
+  auto *drug_type = this->drug_type();
   if (currentDrugConcentration < (0.5))
-    P = 2*drug_type_->p_mutation()*drug_type_->k()*currentDrugConcentration;
+    P = 2*drug_type->p_mutation()*drug_type->k()*currentDrugConcentration;
 
   else if (currentDrugConcentration >= (0.5) && currentDrugConcentration < 1.0) {
-    P = drug_type_->p_mutation()*
-        (2*(1 - drug_type_->k())*currentDrugConcentration + (2*drug_type_->k() - 1));
+    P = drug_type->p_mutation()*
+        (2*(1 - drug_type->k())*currentDrugConcentration + (2*drug_type->k() - 1));
   } else if (currentDrugConcentration >= 1.0) {
-    P = drug_type_->p_mutation();
+    P = drug_type->p_mutation();
   }
   //    cout << P << endl;
   return P;
 }
 
 double Drug::get_mutation_probability() const {
-  return get_mutation_probability(last_update_value_);
+  return get_mutation_probability(last_update_value());
 }
 
 void Drug::set_number_of_dosing_days(int dosingDays) {
 
   dosing_days_ = dosingDays;
 
-  last_update_value_ = 1.0;
+  set_last_update_value(1.0);
   last_update_time_ = Model::SCHEDULER->current_time();
 
   start_time_ = last_update_time_;
-  end_time_ = last_update_time_ + drug_type_->get_total_duration_of_drug_activity(dosingDays);
+  end_time_ = last_update_time_ + drug_type()->get_total_duration_of_drug_activity(dosingDays);
 }
 
 double Drug::get_parasite_killing_rate(int &genotype_id) const {
-  return drug_type_->get_parasite_killing_rate_by_concentration(last_update_value_,
+  return drug_type()->get_parasite_killing_rate_by_concentration(last_update_value(),
                                                                 Model::CONFIG
-                                                                    ->EC50_power_n_table()[genotype_id][drug_type_
-                                                                    ->id()]);
+                                                                    ->EC50_power_n_table()[genotype_id][drug_type_id_]);
 }
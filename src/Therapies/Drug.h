@@ -9,40 +9,75 @@
 #define    DRUG_H
 
 #include "Core/PropertyMacro.h"
-#include "Core/ObjectPool.h"
-#include "Population/DrugsInBlood.h"
 
-class Drug {
- OBJECTPOOL(Drug)
+class DrugType;
+
+class Config;
 
- DISALLOW_COPY_AND_ASSIGN(Drug)
+class Random;
 
+/**
+ * A drug in the blood of a person, stored by value in DrugsInBlood. The drug type is kept as its id in the drug_db of
+ * the config.
+ */
+class Drug {
  PROPERTY_REF(int, dosing_days)
 
  PROPERTY_REF(int, start_time)
 
+ // in the lazy PK mode, refined at the first update of the decay phase to the first day the concentration is at or
+ // below DRUG_CUT_OFF_VALUE
  PROPERTY_REF(int, end_time)
 
- PROPERTY_REF(double, last_update_value)
-
  PROPERTY_REF(int, last_update_time)
 
- PROPERTY_REF(double, starting_value)
+ READ_ONLY_PROPERTY(int, drug_type_id)
+
+ private:
+  // in the lazy PK mode the concentration of the decay phase at last_update_time_ is only evaluated (by its closed
+  // form) when it is read
+  mutable bool is_last_update_value_pending_;
 
- POINTER_PROPERTY(DrugType, drug_type)
+  mutable double last_update_value_;
 
- POINTER_PROPERTY(DrugsInBlood, person_drugs)
+ PROPERTY_REF(double, starting_value)
 
  public:
   explicit Drug(DrugType *drug_type = nullptr);
 
   //    Drug(const Drug& orig);
-  virtual ~Drug();
+  ~Drug();
+
+  DrugType *drug_type() const;
 
   void update();
 
+  /// update() at current_time, with the given config and random generator instead of the ones of the model
+  void update(const int &current_time, Config &config, Random &random);
+
   double get_current_drug_concentration(int currentTime);
 
+  double get_current_drug_concentration(const int &current_time, DrugType *drug_type, Random &random);
+
+  /// concentration days after the start of the drug once dosing has ended, closed form without random draws
+  double get_decay_drug_concentration(const int &days) const;
+
+  static double get_decay_drug_concentration(DrugType *drug_type, const double &starting_value,
+                                             const int &dosing_days, const int &days);
+
+  double last_update_value() const;
+
+  double last_update_value(Config &config) const;
+
+  void set_last_update_value(const double &value);
+
+  /// whether the concentration at last_update_time is at or below DRUG_CUT_OFF_VALUE, without evaluating a pending
+  /// decay concentration
+  bool is_cut_off() const;
+
+  /// first day after the start of the drug whose decay concentration is at or below DRUG_CUT_OFF_VALUE
+  int get_cut_off_days(DrugType *drug_type) const;
+
   double get_mutation_probability() const;
 
   double get_mutation_probability(double currentDrugConcentration) const;
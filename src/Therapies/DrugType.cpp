@@ -17,7 +17,7 @@
 #endif
 
 DrugType::DrugType() : id_(0), drug_half_life_(0), maximum_parasite_killing_rate_(0),
-                       p_mutation_(0), k_(0), cut_off_percent_(0), n_(1) {}
+                       p_mutation_(0), k_(0), cut_off_percent_(0), resistant_allele_bits_(0), n_(1) {}
 
 DrugType::~DrugType() = default;
 
@@ -45,6 +45,40 @@ double DrugType::get_parasite_killing_rate_by_concentration(const double &concen
   return maximum_parasite_killing_rate_ * con_power_n / (con_power_n + EC50_power_n);
 }
 
+void DrugType::get_parasite_killing_rates(const DoubleMatrix &EC50_power_n_table, const int *genotype_ids,
+                                          const std::size_t &number_of_clones, const int *drug_ids,
+                                          const double *concentration_power_n, const double *maximum_killing_rates,
+                                          const std::size_t &number_of_drugs, double *killing_rates) {
+  // gather EC50^n first so that the arithmetic below is one branch free loop over contiguous arrays
+  for (auto c = 0ul; c < number_of_clones; c++) {
+    for (auto d = 0ul; d < number_of_drugs; d++) {
+      const auto i = c * number_of_drugs + d;
+      killing_rates[i] = EC50_power_n_table[genotype_ids[i]][drug_ids[d]];
+    }
+  }
+
+  for (auto c = 0ul; c < number_of_clones; c++) {
+    auto *rates = killing_rates + c * number_of_drugs;
+    for (auto d = 0ul; d < number_of_drugs; d++) {
+      rates[d] = maximum_killing_rates[d] * concentration_power_n[d] / (concentration_power_n[d] + rates[d]);
+    }
+  }
+}
+
+double DrugType::get_percent_parasite_remove(const double *killing_rates, const std::size_t &number_of_drugs) {
+  double percent_parasite_remove = 0;
+  for (auto d = 0ul; d < number_of_drugs; d++) {
+    const auto p_temp = killing_rates[d];
+
+    percent_parasite_remove = percent_parasite_remove + p_temp - percent_parasite_remove * p_temp;
+  }
+  return percent_parasite_remove;
+}
+
+double DrugType::get_concentration_power_n(const double &concentration) const {
+  return pow(concentration, n_);
+}
+
 double DrugType::n() {
   return n_;
 }
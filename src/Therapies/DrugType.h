@@ -10,6 +10,7 @@
 
 #include "Core/TypeDef.h"
 #include "Core/PropertyMacro.h"
+#include "Core/DoubleMatrix.h"
 
 typedef std::map<std::string, double> ec50map_type;
 
@@ -42,6 +43,9 @@ VIRTUAL_PROPERTY_REF(IntVector2, selecting_alleles)
 
 VIRTUAL_PROPERTY_REF(ec50map_type, ec50_map)
 
+  // bits of the selecting alleles of the affecting loci, a genotype resists if it has any of them
+VIRTUAL_PROPERTY_REF(AlleleBits, resistant_allele_bits)
+
 public:
   DrugType();
 
@@ -51,6 +55,23 @@ public:
 
   virtual double get_parasite_killing_rate_by_concentration(const double &concentration, const double &EC50_power_n);
 
+  /**
+   * Killing rates of number_of_drugs drugs against number_of_clones clones in one pass, with the same arithmetic as
+   * get_parasite_killing_rate_by_concentration. Element c * number_of_drugs + d of genotype_ids and killing_rates is
+   * for clone c and drug d; drug d has id drug_ids[d] in EC50_power_n_table and its concentration^n and maximum killing
+   * rate are concentration_power_n[d] and maximum_killing_rates[d].
+   */
+  static void get_parasite_killing_rates(const DoubleMatrix &EC50_power_n_table, const int *genotype_ids,
+                                         const std::size_t &number_of_clones, const int *drug_ids,
+                                         const double *concentration_power_n, const double *maximum_killing_rates,
+                                         const std::size_t &number_of_drugs, double *killing_rates);
+
+  /// fraction of a clone removed by the number_of_drugs drugs acting on it with the given killing rates
+  static double get_percent_parasite_remove(const double *killing_rates, const std::size_t &number_of_drugs);
+
+  /// concentration^n with the same pow as get_parasite_killing_rate_by_concentration
+  double get_concentration_power_n(const double &concentration) const;
+
   virtual double n();
 
   virtual void set_n(const double &n);
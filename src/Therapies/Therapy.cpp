@@ -11,7 +11,7 @@
 #include "Core/Config/Config.h"
 #include "DrugType.h"
 
-Therapy::Therapy() : id_{-1}, testing_day_{-1}, drug_ids{} {
+Therapy::Therapy() : id_{-1}, testing_day_{-1}, drug_ids{}, resistant_allele_bits{0} {
 }
 
 Therapy::~Therapy() = default;
@@ -9,6 +9,7 @@
 #define    THERAPY_H
 
 #include "Core/PropertyMacro.h"
+#include "Core/TypeDef.h"
 #include <vector>
 
 class DrugType;
@@ -23,6 +24,9 @@ VIRTUAL_PROPERTY_REF(int, testing_day)
 public:
   std::vector<int> drug_ids;
 
+  // union of the resistant allele bits of the drugs, only set for SCTherapy (a MACTherapy is never resisted)
+  AlleleBits resistant_allele_bits;
+
 public:
   Therapy();
 
@@ -0,0 +1,109 @@
+//
+// AliasTableTest.cpp
+//
+
+#include "Core/AliasTable.h"
+#include "Core/GuideTable.h"
+#include "Core/MultinomialSampler.h"
+#include "Core/Random.h"
+#include <numeric>
+#include <catch2/catch.hpp>
+
+TEST_CASE("AliasTableTest", "[Core]") {
+
+  SECTION("Each category is drawn with probability proportional to its weight") {
+    const DoubleVector weights{0.5, 0, 3, 1.5, 0, 5};
+    AliasTable table(weights);
+    REQUIRE(table.total_weight() == Approx(10));
+
+    // u on a regular grid covers every column of the table evenly, so the frequencies are exact up to the grid
+    const auto n = 1000000;
+    std::vector<int> count(weights.size(), 0);
+    for (auto i = 0; i < n; i++) {
+      count[table.sample((i + 0.5) / n)]++;
+    }
+    for (auto k = 0ul; k < weights.size(); k++) {
+      REQUIRE(count[k] / static_cast<double>(n) == Approx(weights[k] / 10).margin(1e-5));
+    }
+  }
+
+  SECTION("Table is only rebuilt when the weights change") {
+    DoubleVector weights{1, 2, 3};
+    AliasTable table;
+    REQUIRE(table.build_if_changed(weights.data(), weights.size()));
+    REQUIRE_FALSE(table.build_if_changed(weights.data(), weights.size()));
+    weights[1] = 0;
+    REQUIRE(table.build_if_changed(weights.data(), weights.size()));
+    for (auto i = 0; i < 1000; i++) {
+      REQUIRE(table.sample(i / 1000.0) != 1);
+    }
+  }
+}
+
+TEST_CASE("MultinomialSamplerTest", "[Core]") {
+  Random random;
+  random.initialize(42);
+
+  MultinomialSampler sampler;
+  auto &weights = sampler.weights(4);
+  weights[0] = 1;
+  weights[1] = 0;
+  weights[2] = 2;
+  weights[3] = 7;
+
+  SECTION("Counts add up to the number of trials and follow the weights") {
+    std::vector<double> mean(4, 0);
+    const auto repeats = 2000;
+    for (auto r = 0; r < repeats; r++) {
+      const auto &counts = sampler.sample(&random, 1000);
+      REQUIRE(std::accumulate(counts.begin(), counts.end(), 0u) == 1000);
+      REQUIRE(counts[1] == 0);
+      for (auto k = 0; k < 4; k++) {
+        mean[k] += counts[k] / static_cast<double>(repeats);
+      }
+    }
+    REQUIRE(mean[0] == Approx(100).epsilon(0.02));
+    REQUIRE(mean[2] == Approx(200).epsilon(0.02));
+    REQUIRE(mean[3] == Approx(700).epsilon(0.02));
+  }
+
+  SECTION("External weights reuse the same output buffer") {
+    const DoubleVector external{0, 0, 5};
+    const auto *buffer = sampler.sample(&random, 10).data();
+    const auto &counts = sampler.sample(&random, external.data(), external.size(), 10);
+    REQUIRE(counts.size() == 3);
+    REQUIRE(counts[2] == 10);
+    REQUIRE(counts.data() == buffer);
+  }
+}
+
+TEST_CASE("GuideTableTest", "[Core]") {
+  const auto scan = [](const DoubleVector &weights, const double &p) {
+    double sum = 0;
+    for (auto i = 0ul; i < weights.size(); i++) {
+      sum += weights[i];
+      if (p <= sum) {
+        return i;
+      }
+    }
+    return weights.size();
+  };
+
+  SECTION("Lookup gives the index of the cumulative scan") {
+    const std::vector<DoubleVector> distributions{{1.0}, {0.3, 0.3, 0.4}, {0, 0.25, 0, 0.75}, {0.1, 0.2, 0.3},
+                                                  {0.05, 0.05, 0.05, 0.05, 0.8, 0}, {0.5, -0.1, 0.6}, {}};
+    for (const auto &weights : distributions) {
+      GuideTable table(weights);
+      for (auto i = 0; i <= 100000; i++) {
+        const auto p = i / 100000.0;
+        REQUIRE(table.index(p) == scan(weights, p));
+      }
+      // boundaries of the cumulative sums
+      double sum = 0;
+      for (auto w : weights) {
+        sum += w;
+        REQUIRE(table.index(sum) == scan(weights, sum));
+      }
+    }
+  }
+}
@@ -0,0 +1,71 @@
+#include "Core/Config/Config.h"
+#include "Core/Config/ConfigCache.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <catch2/catch.hpp>
+
+TEST_CASE("ConfigCacheTest", "[Core]") {
+  Config c;
+  c.read_from_file("input.yml");
+  c.write_cache("input.yml", "input_test.masimcfg");
+
+  SECTION("Config read with a cache has the same derived tables") {
+    Config cached;
+    cached.read_from_file("input.yml", "input_test.masimcfg");
+
+    REQUIRE(cached.spatial_distance_matrix().number_of_computed_rows() == c.number_of_locations());
+    REQUIRE(cached.spatial_distance_matrix().to_dense() == c.spatial_distance_matrix().to_dense());
+    REQUIRE(cached.EC50_power_n_table() == c.EC50_power_n_table());
+    REQUIRE(cached.genotype_db()->mating_matrix() == c.genotype_db()->mating_matrix());
+    REQUIRE(cached.relative_bitting_info().v_biting_level_density == c.relative_bitting_info().v_biting_level_density);
+    REQUIRE(cached.relative_bitting_info().v_biting_level_value == c.relative_bitting_info().v_biting_level_value);
+    REQUIRE(cached.circulation_info().v_moving_level_density == c.circulation_info().v_moving_level_density);
+    REQUIRE(cached.circulation_info().v_moving_level_value == c.circulation_info().v_moving_level_value);
+  }
+
+  SECTION("A matrix with a cutoff is cached as its sparse rows") {
+    // the locations of input.yml are 1 degree apart, so 150km keeps the direct neighbours but not the diagonal ones
+    std::ifstream input("input.yml");
+    std::stringstream content;
+    content << input.rdbuf();
+    auto yaml = content.str();
+    yaml.replace(yaml.find("cutoff_in_km: 0"), std::string("cutoff_in_km: 0").size(), "cutoff_in_km: 150");
+    std::ofstream("input_cutoff_test.yml") << yaml;
+
+    Config sparse;
+    sparse.read_from_file("input_cutoff_test.yml");
+    sparse.write_cache("input_cutoff_test.yml", "input_cutoff_test.masimcfg");
+
+    ConfigCache cache;
+    REQUIRE(cache.load("input_cutoff_test.masimcfg", "input_cutoff_test.yml"));
+    const auto number_of_locations = static_cast<std::size_t>(sparse.number_of_locations());
+    REQUIRE(cache.vector(ConfigCache::SPATIAL_DISTANCE_ROW_OFFSETS).size() == number_of_locations + 1);
+    REQUIRE(cache.float_vector(ConfigCache::SPATIAL_DISTANCE_VALUES).size() < number_of_locations * number_of_locations);
+    REQUIRE(cache.int_vector(ConfigCache::SPATIAL_DISTANCE_LOCATIONS).size()
+                == cache.float_vector(ConfigCache::SPATIAL_DISTANCE_VALUES).size());
+
+    Config cached;
+    cached.read_from_file("input_cutoff_test.yml", "input_cutoff_test.masimcfg");
+    REQUIRE(cached.spatial_distance_matrix().number_of_computed_rows() == sparse.number_of_locations());
+    for (auto from_location = 0; from_location < sparse.number_of_locations(); from_location++) {
+      REQUIRE(cached.spatial_distance_matrix().row(from_location).locations
+                  == sparse.spatial_distance_matrix().row(from_location).locations);
+      REQUIRE(cached.spatial_distance_matrix().row(from_location).distances
+                  == sparse.spatial_distance_matrix().row(from_location).distances);
+    }
+
+    std::remove("input_cutoff_test.masimcfg");
+    std::remove("input_cutoff_test.yml");
+  }
+
+  SECTION("Cache built from another input is rejected") {
+    ConfigCache cache;
+    REQUIRE(cache.load("input_test.masimcfg", "input.yml"));
+    REQUIRE(cache.has(ConfigCache::MATING_MATRIX));
+    REQUIRE_FALSE(cache.load("input_test.masimcfg", "not_the_same_input.yml"));
+    REQUIRE_FALSE(cache.has(ConfigCache::MATING_MATRIX));
+  }
+
+  std::remove("input_test.masimcfg");
+}
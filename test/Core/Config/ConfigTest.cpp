@@ -115,8 +115,8 @@ TEST_CASE("ConfigTest", "[Core]") {
 
     REQUIRE(c.number_of_locations() == 9);
 
-    REQUIRE(c.spatial_distance_matrix().size() == 9);
-    REQUIRE(c.spatial_distance_matrix()[8].size() == 9);
+    REQUIRE(c.spatial_distance_matrix().number_of_locations() == 9);
+    REQUIRE(c.spatial_distance_matrix().row(8).size() == 9);
 
     REQUIRE(c.seasonal_info().A == DoubleVector(9, 1.0));
 
@@ -140,8 +140,8 @@ TEST_CASE("ConfigTest", "[Core]") {
     REQUIRE(c.drug_db()->at(6)->n() == 19);
 
     //
-    REQUIRE(c.EC50_power_n_table().size() == 128);
-    REQUIRE(c.EC50_power_n_table()[0].size() == 7);
+    REQUIRE(c.EC50_power_n_table().rows() == 128);
+    REQUIRE(c.EC50_power_n_table().cols() == 7);
     //
     REQUIRE(c.circulation_info().max_relative_moving_value == 35);
     //
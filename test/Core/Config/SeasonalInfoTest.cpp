@@ -0,0 +1,52 @@
+#include "Core/Config/Config.h"
+#include "Constants.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <catch2/catch.hpp>
+
+TEST_CASE("SeasonalInfoTest", "[Core]") {
+  Config c;
+  c.read_from_file("input.yml");
+  const auto &info = c.seasonal_info();
+
+  SECTION("Factor table matches the seasonal equation") {
+    REQUIRE(info.factors.size() == c.number_of_locations() * SeasonalInfo::DAYS_IN_TABLE);
+    for (auto location = 0; location < static_cast<int>(c.number_of_locations()); location++) {
+      for (auto day_of_year = 1; day_of_year <= 366; day_of_year++) {
+        const auto half_year = Constants::DAYS_IN_YEAR() / 2.0;
+        const auto is_rainy_period = info.phi[location] < half_year
+                                     ? day_of_year >= info.phi[location] && day_of_year <= info.phi[location] + half_year
+                                     : day_of_year >= info.phi[location] || day_of_year <= info.phi[location] - half_year;
+        const auto expected = is_rainy_period
+                              ? (info.A[location] - info.min_value[location]) *
+                                sin(info.B[location] * day_of_year + info.C[location]) + info.min_value[location]
+                              : info.min_value[location];
+        REQUIRE(info.get_factor(location, day_of_year) == expected);
+      }
+    }
+  }
+
+  SECTION("Daily factors can be read from a file") {
+    {
+      std::ofstream file("seasonal_test.csv");
+      file << "# one line for every location\n";
+      for (auto day = 1; day <= 365; day++) {
+        file << (day == 1 ? "" : ",") << day / 365.0;
+      }
+      file << "\n";
+    }
+
+    c.seasonal_info.set_value(YAML::Load("seasonal_info: {enable: true, daily_factors_file: seasonal_test.csv}"));
+    REQUIRE(c.seasonal_info().get_factor(0, 1) == Approx(1 / 365.0));
+    REQUIRE(c.seasonal_info().get_factor(8, 200) == Approx(200 / 365.0));
+    REQUIRE(c.seasonal_info().get_factor(8, 366) == Approx(1.0));
+    std::remove("seasonal_test.csv");
+  }
+
+  SECTION("Disabled seasonality gives a factor of 1") {
+    c.seasonal_info.set_value(YAML::Load("seasonal_info: {enable: false, a: [1], phi: [250], min_value: [0.1], period: 365}"));
+    REQUIRE(c.seasonal_info().factors.empty());
+    REQUIRE(c.seasonal_info().get_factor(3, 100) == 1.0);
+  }
+}
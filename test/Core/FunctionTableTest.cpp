@@ -0,0 +1,67 @@
+//
+// FunctionTableTest.cpp
+//
+
+#include "Core/FunctionTable.h"
+#include "Core/Config/Config.h"
+#include "Population/ImmuneSystem.h"
+#include <cmath>
+#include <gsl/gsl_cdf.h>
+#include <catch2/catch.hpp>
+
+TEST_CASE("FunctionTableTest", "[Core]") {
+  SECTION("Resolution is refined until the error bound holds") {
+    FunctionTable table;
+    table.build([](const double &x) { return sin(x); }, 0, 10, 1e-7, 1 << 20);
+    REQUIRE(table.is_tabulated());
+    REQUIRE(table.number_of_points() > FunctionTable::INITIAL_NUMBER_OF_POINTS);
+    REQUIRE(table.max_error() <= 1e-7);
+    REQUIRE(table.validate(100003) <= 1e-7);
+    REQUIRE(table(0) == 0);
+    REQUIRE(table(12.5) == sin(12.5));
+  }
+
+  SECTION("Exact evaluation is used when the bound cannot be reached") {
+    FunctionTable table;
+    table.build([](const double &x) { return sqrt(x); }, 0, 1, 1e-9, 1000);
+    REQUIRE_FALSE(table.is_tabulated());
+    REQUIRE(table(0.3) == sqrt(0.3));
+
+    table.build([](const double &x) { return sqrt(x); }, 0, 1, 0, 1000);
+    REQUIRE_FALSE(table.is_tabulated());
+  }
+
+  SECTION("The config evaluates the exact curves by default") {
+    Config c;
+    c.read_from_file("input.yml");
+    REQUIRE(c.function_table_max_error() == 0);
+    REQUIRE_FALSE(c.function_tables().relative_infectivity.is_tabulated());
+    REQUIRE_FALSE(c.function_tables().clinical_progression.is_tabulated());
+    REQUIRE_FALSE(c.function_tables().exp_minus.is_tabulated());
+  }
+
+  SECTION("Tables of the config stay within the error bound of the exact curves") {
+    Config c;
+    c.read_from_file("input.yml", "", "{function_table_max_error: 1e-6}");
+    const auto max_error = c.function_table_max_error();
+    auto &tables = c.function_tables();
+
+    REQUIRE(tables.relative_infectivity.is_tabulated());
+    REQUIRE(tables.clinical_progression.is_tabulated());
+    REQUIRE(tables.exp_minus.is_tabulated());
+
+    const auto &pdl = c.parasite_density_level();
+    for (auto i = 0; i <= 10000; i++) {
+      const auto x = pdl.log_parasite_density_cured + (pdl.log_parasite_density_clinical_to - pdl.log_parasite_density_cured) * i / 10000.0;
+      const auto p = gsl_cdf_ugaussian_P(x * c.relative_infectivity().sigma + c.relative_infectivity().ro_star);
+      REQUIRE(std::fabs(tables.relative_infectivity(x) - (p * p + 0.01)) <= max_error);
+
+      const auto immune = i / 10000.0;
+      REQUIRE(std::fabs(tables.clinical_progression(immune) - ImmuneSystem::get_clinical_progression_probability(
+          c.immune_system_information(), immune)) <= max_error);
+
+      const auto rate_times_duration = 50.0 * i / 10000.0;
+      REQUIRE(std::fabs(tables.exp_minus(rate_times_duration) - exp(-rate_times_duration)) <= max_error);
+    }
+  }
+}
@@ -0,0 +1,186 @@
+//
+// SchedulerTest.cpp
+//
+
+#include "Core/Scheduler.h"
+#include "Model.h"
+#include "Events/Population/DeathEvent.h"
+#include "Events/Population/ImportationEvent.h"
+#include "Events/Population/ImportationPeriodicallyEvent.h"
+#include "Population/Population.h"
+#include "Population/ParasiteImporter.h"
+#include <catch2/catch.hpp>
+
+namespace {
+// runs update_population_event_step on each day from the current time to time, without executing any event
+void step_to(Scheduler *scheduler, const int &time) {
+  while (scheduler->current_time() < time) {
+    scheduler->move_to_next_day();
+    scheduler->update_population_event_step();
+  }
+}
+}
+
+TEST_CASE("SchedulerTest", "[Core]") {
+  SECTION("A tau leap stops before a day with population events and at the start of a month") {
+    // starting_date: 1990/1/1, no population event other than the one scheduled below
+    Model model;
+    model.set_config_filename("input.yml");
+    model.set_config_overrides(
+        "{artificial_rescaling_of_population_size: 0.1, using_tau_leaping: true, tau_leaping_step: 7, events: []}");
+    model.set_initial_seed_number(5);
+    model.set_reporter_type("None");
+    model.initialize();
+
+    auto *scheduler = Model::SCHEDULER;
+    // 1990/2/10
+    ImportationEvent::schedule_event(scheduler, 0, 40, 1, 5);
+
+    scheduler->update_population_event_step();
+    REQUIRE(scheduler->population_event_step() == 7);
+    for (auto time = 1; time < 7; time++) {
+      step_to(scheduler, time);
+      REQUIRE(scheduler->population_event_step() == 0);
+    }
+    step_to(scheduler, 7);
+    REQUIRE(scheduler->population_event_step() == 7);
+
+    // 1990/1/29 to 1990/1/31, the leap stops before 1990/2/1
+    step_to(scheduler, 28);
+    REQUIRE(scheduler->population_event_step() == 3);
+    step_to(scheduler, 31);
+    REQUIRE(scheduler->population_event_step() == 7);
+
+    // 1990/2/8 and 1990/2/9, the leap stops before the importation on 1990/2/10
+    step_to(scheduler, 38);
+    REQUIRE(scheduler->population_event_step() == 2);
+    // the day of the importation is stepped on its own
+    step_to(scheduler, 40);
+    REQUIRE(scheduler->population_event_step() == 1);
+    step_to(scheduler, 41);
+    REQUIRE(scheduler->population_event_step() == 7);
+
+    REQUIRE_FALSE(scheduler->is_fast_forwarding());
+  }
+
+  SECTION("A periodic importation does not stop a tau leap and imports the cases of the leap over its days") {
+    // starting_date: 1990/1/1, no population event other than the one scheduled below
+    Model model;
+    model.set_config_filename("input.yml");
+    model.set_config_overrides(
+        "{artificial_rescaling_of_population_size: 0.1, using_tau_leaping: true, tau_leaping_step: 7, events: []}");
+    model.set_initial_seed_number(5);
+    model.set_reporter_type("None");
+    model.initialize();
+
+    auto *scheduler = Model::SCHEDULER;
+    // 10 cases a day at location 0 from the first day
+    ImportationPeriodicallyEvent::schedule_event(scheduler, 0, 1, 0, 10, 0);
+
+    scheduler->update_population_event_step();
+    REQUIRE(scheduler->population_event_step() == 7);
+    scheduler->execute_events_list(scheduler->population_events_list_[0]);
+
+    // the importation is scheduled again on the first day of the next leap and the cases of the other days of the
+    // leap are imported on those days
+    REQUIRE(scheduler->population_events_list_[7].size() == 1);
+    for (auto time = 1; time < 7; time++) {
+      REQUIRE(scheduler->population_events_list_[time].size() <= 1);
+      for (auto *event : scheduler->population_events_list_[time]) {
+        REQUIRE(event->name() == "ImportationPeriodicallyEvent");
+      }
+    }
+    step_to(scheduler, 7);
+    REQUIRE(scheduler->population_event_step() == 7);
+  }
+
+  SECTION("The deaths of a tau leap are given on random days of the leap") {
+    Model model;
+    model.set_config_filename("input.yml");
+    model.set_config_overrides(
+        "{artificial_rescaling_of_population_size: 0.1, using_tau_leaping: true, tau_leaping_step: 7, events: [],"
+        " death_rate_by_age_class: [1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1]}");
+    model.set_initial_seed_number(5);
+    model.set_reporter_type("None");
+    model.initialize();
+
+    auto *scheduler = Model::SCHEDULER;
+    scheduler->update_population_event_step();
+    REQUIRE(scheduler->population_event_step() == 7);
+
+    const auto size = Model::POPULATION->size();
+    Model::POPULATION->perform_death_event(scheduler->population_event_step());
+    const auto deaths_today = size - Model::POPULATION->size();
+
+    std::size_t later_deaths = 0;
+    for (auto time = 1; time < 7; time++) {
+      for (auto *event : scheduler->population_events_list_[time]) {
+        REQUIRE(event->name() == "DeathEvent");
+        later_deaths++;
+      }
+    }
+    REQUIRE(deaths_today > 0);
+    REQUIRE(later_deaths > 3 * deaths_today);
+    REQUIRE(scheduler->population_events_list_[7].empty());
+
+    for (auto time = 1; time < 7; time++) {
+      scheduler->move_to_next_day();
+      scheduler->execute_events_list(scheduler->population_events_list_[time]);
+    }
+    REQUIRE(size - Model::POPULATION->size() == deaths_today + later_deaths);
+  }
+
+  SECTION("A quiescent period starts after the tracking days without case and ends with a case") {
+    // starting_date: 1990/1/1, number_of_tracking_days: 11, no case and no population event
+    Model model;
+    model.set_config_filename("input.yml");
+    model.set_config_overrides(
+        "{artificial_rescaling_of_population_size: 0.1, using_adaptive_time_step: true, adaptive_time_step_max_days: 30,"
+        " initial_parasite_info: [], events: []}");
+    model.set_initial_seed_number(5);
+    model.set_reporter_type("None");
+    model.initialize();
+
+    auto *scheduler = Model::SCHEDULER;
+    scheduler->update_population_event_step();
+    REQUIRE(scheduler->population_event_step() == 1);
+    step_to(scheduler, 10);
+    REQUIRE(scheduler->population_event_step() == 1);
+    REQUIRE_FALSE(scheduler->is_fast_forwarding());
+
+    // 1990/1/12 to 1990/1/31, fast-forwarded after the 12th day without case
+    step_to(scheduler, 11);
+    REQUIRE(scheduler->is_fast_forwarding());
+    REQUIRE(scheduler->population_event_step() == 20);
+    REQUIRE(scheduler->infection_event_step() == 20);
+    REQUIRE(scheduler->number_of_quiescent_periods() == 1);
+    step_to(scheduler, 30);
+    REQUIRE(scheduler->population_event_step() == 0);
+    REQUIRE(scheduler->infection_event_step() == 0);
+    REQUIRE(scheduler->number_of_fast_forwarded_days() == 19);
+
+    // the whole of February
+    step_to(scheduler, 31);
+    REQUIRE(scheduler->population_event_step() == 28);
+    REQUIRE(scheduler->number_of_quiescent_periods() == 2);
+    step_to(scheduler, 40);
+    REQUIRE(scheduler->number_of_fast_forwarded_days() == 28);
+
+    // a case ends the period, the infections of its remaining days are drawn daily
+    ParasiteImporter::import(ImportationSpec(0, 1, IntVector{1}, DoubleVector{1.0}), 1);
+    step_to(scheduler, 41);
+    REQUIRE_FALSE(scheduler->is_fast_forwarding());
+    REQUIRE(scheduler->population_event_step() == 0);
+    REQUIRE(scheduler->infection_event_step() == 1);
+    REQUIRE(scheduler->number_of_interrupted_quiescent_periods() == 1);
+    step_to(scheduler, 58);
+    REQUIRE(scheduler->infection_event_step() == 1);
+    REQUIRE(scheduler->number_of_fast_forwarded_days() == 28);
+
+    // daily stepping from 1990/3/1
+    step_to(scheduler, 59);
+    REQUIRE_FALSE(scheduler->is_fast_forwarding());
+    REQUIRE(scheduler->population_event_step() == 1);
+    REQUIRE(scheduler->infection_event_step() == 1);
+  }
+}
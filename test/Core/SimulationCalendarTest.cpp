@@ -0,0 +1,55 @@
+//
+// SimulationCalendarTest.cpp
+//
+
+#include "Core/SimulationCalendar.h"
+#include "Helpers/TimeHelpers.h"
+#include <catch2/catch.hpp>
+
+using namespace date::literals;
+
+TEST_CASE("SimulationCalendarTest", "[Core]") {
+  const date::sys_days starting_date{1999_y/11/20};
+  SimulationCalendar calendar;
+  calendar.initialize(starting_date, 3 * 365);
+
+  SECTION("Every day matches the date conversions") {
+    for (auto i = 0; i < calendar.number_of_days(); i++) {
+      const auto today = starting_date + date::days{i};
+      const date::year_month_day ymd{today};
+      const auto &day = calendar[i];
+      REQUIRE(day.year==static_cast<int>(ymd.year()));
+      REQUIRE(day.month==static_cast<unsigned>(ymd.month()));
+      REQUIRE(day.day==static_cast<unsigned>(ymd.day()));
+      REQUIRE(day.day_of_year==TimeHelpers::day_of_year(today));
+      REQUIRE(day.days_to_next_year==TimeHelpers::number_of_days_to_next_year(today));
+      REQUIRE(day.is_first_day_of_month==(ymd.day()==date::day{1}));
+      REQUIRE(day.is_first_day_of_year==(ymd.month()==date::jan && ymd.day()==date::day{1}));
+      REQUIRE(day.is_last_day_of_month==(ymd.day()==(ymd.year()/ymd.month()/date::last).day()));
+      REQUIRE(day.is_last_day_of_year==(ymd.month()==date::dec && ymd.day()==date::day{31}));
+    }
+  }
+
+  SECTION("Dates outside of the span are converted on the fly") {
+    const date::sys_days leap_day{2000_y/2/29};
+    REQUIRE(calendar.day_of(leap_day).day_of_year==60);
+
+    const date::sys_days later{2010_y/12/31};
+    REQUIRE(calendar.day_of(later).day_of_year==365);
+    REQUIRE(calendar.day_of(later).is_last_day_of_year);
+
+    calendar.extend(12 * 366);
+    REQUIRE(calendar[TimeHelpers::number_of_days(starting_date, later)].is_last_day_of_year);
+  }
+
+  SECTION("Simulation time birthday matches the date arithmetic") {
+    for (auto age = 0; age < 90; age++) {
+      for (auto days_to_next_birthday = 0; days_to_next_birthday < 365; days_to_next_birthday += 7) {
+        const auto calendar_birthday = date::floor<date::days>(
+            starting_date + date::days{days_to_next_birthday + 1} - date::years{age + 1});
+        REQUIRE(TimeHelpers::get_simulation_time_birthday(days_to_next_birthday, age, starting_date)
+                    ==TimeHelpers::number_of_days(starting_date, calendar_birthday));
+      }
+    }
+  }
+}
@@ -0,0 +1,42 @@
+//
+// SubsetSamplerTest.cpp
+//
+
+#include "Core/SubsetSampler.h"
+#include "Core/Random.h"
+#include <set>
+#include <catch2/catch.hpp>
+
+TEST_CASE("SubsetSamplerTest", "[Core]") {
+  Random random;
+  random.initialize(17);
+  SubsetSampler sampler;
+
+  SECTION("Positions are distinct and in range") {
+    for (auto k : {0ul, 1ul, 10ul, 400ul, 1000ul, 1500ul}) {
+      const auto &positions = sampler.sample(&random, 1000, k);
+      REQUIRE(positions.size() == std::min(k, 1000ul));
+      std::set<std::size_t> distinct(positions.begin(), positions.end());
+      REQUIRE(distinct.size() == positions.size());
+      REQUIRE((positions.empty() || *distinct.rbegin() < 1000));
+    }
+  }
+
+  SECTION("Every position is drawn with probability k / n") {
+    // sparse (k = 5) and dense (k = 30) buffers
+    for (auto k : {5ul, 30ul}) {
+      const auto n = 50ul;
+      const auto number_of_samples = 20000;
+      std::vector<int> counts(n, 0);
+      for (auto s = 0; s < number_of_samples; s++) {
+        for (auto position : sampler.sample(&random, n, k)) {
+          counts[position]++;
+        }
+      }
+      const auto expected = static_cast<double>(number_of_samples) * k / n;
+      for (auto count : counts) {
+        REQUIRE(count == Approx(expected).epsilon(0.1));
+      }
+    }
+  }
+}
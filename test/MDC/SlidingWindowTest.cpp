@@ -0,0 +1,62 @@
+//
+// SlidingWindowTest.cpp
+//
+
+#include "MDC/SlidingWindow.h"
+#include <vector>
+#include <random>
+#include <catch2/catch.hpp>
+
+TEST_CASE("SlidingWindowTest", "[MDC]") {
+
+  SECTION("Running sum is equal to re-summing the whole window every day") {
+    std::mt19937 g(2020);
+    std::poisson_distribution<int> today_treatments(3.5);
+
+    const auto tf_window_size = 60;
+    const auto start_collect_data_day = 365;
+
+    // previous implementation: IntVector indexed by current_time % tf_window_size, re-summed every day
+    std::vector<int> total_60(tf_window_size, 0);
+    SlidingWindow<int> window(tf_window_size, 0);
+
+    for (auto current_time = start_collect_data_day; current_time < start_collect_data_day + 3000; current_time++) {
+      const auto today = today_treatments(g);
+
+      total_60[current_time % tf_window_size] = today;
+      auto t_treatment60 = 0;
+      for (auto i = 0; i < tf_window_size; i++) {
+        t_treatment60 += total_60[i];
+      }
+
+      window.set(current_time, today);
+
+      REQUIRE(window.sum() == t_treatment60);
+      REQUIRE(window.get(current_time) == today);
+      REQUIRE(window.values() == total_60);
+    }
+  }
+
+  SECTION("Floating point window keeps the same slots and a bounded sum error") {
+    std::mt19937 g(7);
+    std::uniform_real_distribution<double> prevalence(0.0, 1.0);
+
+    const auto report_frequency = 30;
+    std::vector<double> last_10(10, 0.0);
+    SlidingWindow<double> window(10, 0.0);
+
+    for (auto current_time = 0; current_time < 100000; current_time += report_frequency) {
+      const auto value = prevalence(g);
+      last_10[(current_time / report_frequency) % 10] = value;
+      window.set(current_time / report_frequency, value);
+
+      auto expected = 0.0;
+      for (auto v : last_10) {
+        expected += v;
+      }
+
+      REQUIRE(window.values() == last_10);
+      REQUIRE(window.sum() == Approx(expected).epsilon(1e-12));
+    }
+  }
+}
@@ -0,0 +1,60 @@
+//
+// TopShareSketchTest.cpp
+//
+
+#include "MDC/TopShareSketch.h"
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <catch2/catch.hpp>
+
+TEST_CASE("TopShareSketchTest", "[MDC]") {
+
+  SECTION("Sum of largest values is within the relative error of the exact sum") {
+    std::mt19937 g(1234);
+    std::gamma_distribution<double> bites(0.5, 2.0);
+
+    const auto relative_error = 0.01;
+    TopShareSketch sketch(relative_error);
+    std::vector<double> values;
+    for (auto i = 0; i < 100000; i++) {
+      const auto v = (i % 10 == 0) ? 0.0 : bites(g);
+      values.push_back(v);
+      sketch.add(v);
+    }
+    std::sort(values.begin(), values.end(), std::greater<>());
+
+    for (auto k : {1l, 10l, 1000l, 20001l, 95000l, 100000l, 200000l}) {
+      auto exact = 0.0;
+      for (auto i = 0l; i < std::min(k, static_cast<long>(values.size())); i++) {
+        exact += values[i];
+      }
+      REQUIRE(std::abs(sketch.sum_of_largest(k) - exact) <= relative_error * exact);
+    }
+
+    REQUIRE(sketch.count() == 100000);
+    REQUIRE(sketch.sum_of_largest(100000) == Approx(sketch.total()));
+  }
+
+  SECTION("Memory does not grow with the number of values") {
+    TopShareSketch sketch(0.01);
+    std::mt19937 g(42);
+    std::uniform_real_distribution<double> u(0.001, 10.0);
+    for (auto i = 0; i < 1000000; i++) {
+      sketch.add(u(g));
+    }
+    // log(10 / 0.001) / log(1.01) ~ 926 buckets
+    REQUIRE(sketch.number_of_buckets() <= 927);
+  }
+
+  SECTION("Clear resets the sketch") {
+    TopShareSketch sketch;
+    sketch.add(1.0);
+    sketch.add(0.0);
+    sketch.clear();
+    REQUIRE(sketch.count() == 0);
+    REQUIRE(sketch.total() == 0);
+    REQUIRE(sketch.sum_of_largest(10) == 0);
+  }
+}
@@ -0,0 +1,75 @@
+//
+// GenotypeTest.cpp
+//
+
+#include "Core/Config/Config.h"
+#include "Parasites/Genotype.h"
+#include "Therapies/SCTherapy.h"
+#include <catch2/catch.hpp>
+
+namespace {
+bool resist_by_alleles(Genotype *genotype, DrugType *dt) {
+  for (auto i = 0ul; i < dt->affecting_loci().size(); i++) {
+    for (auto allele : dt->selecting_alleles()[i]) {
+      if (genotype->gene_expression()[dt->affecting_loci()[i]] == allele) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+}
+
+TEST_CASE("GenotypeTest", "[Parasites]") {
+  Config c;
+  c.read_from_file("input.yml");
+
+  SECTION("Allele bits hold one allele per locus") {
+    for (auto &g : *c.genotype_db()) {
+      auto *genotype = g.second;
+      AlleleBits expected = 0;
+      for (auto locus = 0ul; locus < genotype->gene_expression().size(); locus++) {
+        expected |= Genotype::allele_bit(c.genotype_info(), locus, genotype->gene_expression()[locus]);
+      }
+      REQUIRE(genotype->allele_bits() == expected);
+    }
+  }
+
+  SECTION("Mutation table gives the genotype of every mutation value") {
+    for (auto &g : *c.genotype_db()) {
+      auto *genotype = g.second;
+      for (auto locus = 0ul; locus < genotype->gene_expression().size(); locus++) {
+        const auto &mutation_values = c.genotype_info().loci_vector[locus]
+            .alleles[genotype->gene_expression()[locus]].mutation_values;
+        REQUIRE(c.genotype_db()->number_of_mutation_targets(genotype->genotype_id(), locus) == mutation_values.size());
+        for (auto i = 0ul; i < mutation_values.size(); i++) {
+          auto gene_expression = genotype->gene_expression();
+          gene_expression[locus] = mutation_values[i];
+          REQUIRE(c.genotype_db()->mutation_target(genotype->genotype_id(), locus, i) ==
+              c.genotype_db()->get_id(gene_expression));
+        }
+      }
+    }
+  }
+
+  SECTION("Resistance masks agree with the selecting alleles") {
+    for (auto &g : *c.genotype_db()) {
+      auto *genotype = g.second;
+      for (auto &d : *c.drug_db()) {
+        const auto expected = resist_by_alleles(genotype, d.second);
+        REQUIRE(genotype->resist_to(d.second) == expected);
+        REQUIRE(genotype->resist_to(d.first) == expected);
+      }
+
+      for (auto *therapy : c.therapy_db()) {
+        auto expected = false;
+        if (dynamic_cast<SCTherapy *>(therapy) != nullptr) {
+          for (auto drug_id : therapy->drug_ids) {
+            expected = expected || resist_by_alleles(genotype, c.drug_db()->at(drug_id));
+          }
+        }
+        REQUIRE(genotype->resist_to(therapy) == expected);
+      }
+    }
+  }
+}
@@ -0,0 +1,85 @@
+//
+// DrugsInBloodTest.cpp
+//
+
+#include "Population/DrugsInBlood.h"
+#include "Therapies/DrugType.h"
+#include <algorithm>
+#include <catch2/catch.hpp>
+
+TEST_CASE("DrugsInBloodTest", "[Population]") {
+  DrugType drug_types[2 * DrugsInBlood::CAPACITY + 1];
+  for (auto i = 0; i < 2 * DrugsInBlood::CAPACITY + 1; i++) {
+    drug_types[i].set_id(i);
+  }
+
+  DrugsInBlood drugs_in_blood;
+  drugs_in_blood.init();
+
+  const auto add = [&](const int &type_id, const double &value, const int &dosing_days) {
+    Drug drug(&drug_types[type_id]);
+    drug.set_last_update_value(value);
+    drug.set_dosing_days(dosing_days);
+    return drugs_in_blood.add_drug(drug);
+  };
+
+  add(3, 0.8, 3);
+  add(0, 0.05, 3);
+  add(4, 1.0, 3);
+  add(1, 0.9, 2);
+
+  SECTION("Drugs are kept sorted by drug type id") {
+    REQUIRE(drugs_in_blood.size() == 4);
+    IntVector ids;
+    for (auto &drug : drugs_in_blood) {
+      ids.push_back(drug.drug_type_id());
+    }
+    REQUIRE(ids == IntVector{0, 1, 3, 4});
+    REQUIRE(drugs_in_blood.is_drug_in_blood(3));
+    REQUIRE_FALSE(drugs_in_blood.is_drug_in_blood(2));
+    REQUIRE(drugs_in_blood.get_drug(2) == nullptr);
+  }
+
+  SECTION("Adding a drug already in blood updates its dosing") {
+    auto *drug = add(3, 0.6, 5);
+    REQUIRE(drugs_in_blood.size() == 4);
+    REQUIRE(drug == drugs_in_blood.get_drug(3));
+    REQUIRE(drug->dosing_days() == 5);
+    REQUIRE(drug->last_update_value() == 0.6);
+  }
+
+  SECTION("Removing and clearing cut off drugs keep the order") {
+    drugs_in_blood.remove_drug(1);
+    drugs_in_blood.remove_drug(2);
+    REQUIRE(drugs_in_blood.size() == 3);
+
+    drugs_in_blood.clear_cut_off_drugs_by_event(nullptr);
+    REQUIRE(drugs_in_blood.size() == 2);
+    REQUIRE(drugs_in_blood.begin()->drug_type_id() == 3);
+    REQUIRE(drugs_in_blood.get_drug(4)->last_update_value() == 1.0);
+
+    drugs_in_blood.clear();
+    REQUIRE(drugs_in_blood.size() == 0);
+  }
+
+  SECTION("Drugs beyond the inline capacity spill to the heap") {
+    REQUIRE(drugs_in_blood.capacity() == DrugsInBlood::CAPACITY);
+    for (auto type_id = 2 * DrugsInBlood::CAPACITY; type_id > 4; type_id--) {
+      add(type_id, 0.5, 3);
+    }
+    REQUIRE(drugs_in_blood.size() == 2 * DrugsInBlood::CAPACITY);
+    REQUIRE(drugs_in_blood.capacity() >= drugs_in_blood.size());
+
+    IntVector ids;
+    for (auto &drug : drugs_in_blood) {
+      ids.push_back(drug.drug_type_id());
+    }
+    REQUIRE(std::is_sorted(ids.begin(), ids.end()));
+    REQUIRE(drugs_in_blood.get_drug(3)->last_update_value() == 0.8);
+    REQUIRE(drugs_in_blood.get_drug(2 * DrugsInBlood::CAPACITY)->last_update_value() == 0.5);
+
+    drugs_in_blood.remove_drug(0);
+    REQUIRE_FALSE(drugs_in_blood.is_drug_in_blood(0));
+    REQUIRE(drugs_in_blood.size() == 2 * DrugsInBlood::CAPACITY - 1);
+  }
+}
@@ -0,0 +1,88 @@
+//
+// ParasiteImporterTest.cpp
+//
+
+#include "Population/ParasiteImporter.h"
+#include "Model.h"
+#include "Core/Config/Config.h"
+#include "Core/Random.h"
+#include "Parasites/Genotype.h"
+#include "Population/Population.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Population/Properties/PersonIndexByLocationStateAgeClass.h"
+#include <map>
+#include <catch2/catch.hpp>
+
+namespace {
+std::size_t number_of_persons(PersonIndexByLocationStateAgeClass *pi, const int &location,
+                              const Person::HostStates &host_state) {
+  std::size_t result = 0;
+  for (const auto &persons : pi->vPerson()[location][host_state]) {
+    result += persons.size();
+  }
+  return result;
+}
+}
+
+TEST_CASE("ParasiteImporterTest", "[Population]") {
+  SECTION("Imported genotypes follow the weights of the spec") {
+    Random random;
+    random.initialize(3);
+    const ImportationSpec spec(2, 10, IntVector{4, 9, 12}, DoubleVector{1.0, 3.0, 0.0});
+
+    const auto number_of_draws = 100000;
+    std::map<int, int> counts;
+    for (auto i = 0; i < number_of_draws; i++) {
+      counts[spec.draw_genotype_id(&random)]++;
+    }
+    REQUIRE(counts.size() == 2);
+    REQUIRE(counts[4] == Approx(0.25 * number_of_draws).epsilon(0.03));
+    REQUIRE(counts[9] == Approx(0.75 * number_of_draws).epsilon(0.03));
+  }
+
+  SECTION("Cases are imported into the susceptible persons of the spec location") {
+    Model model;
+    model.set_config_filename("input.yml");
+    model.set_config_overrides("{artificial_rescaling_of_population_size: 0.2}");
+    model.set_initial_seed_number(5);
+    model.set_reporter_type("None");
+    model.initialize();
+
+    auto *pi = Model::POPULATION->get_person_index<PersonIndexByLocationStateAgeClass>();
+    const auto number_of_locations = Model::CONFIG->number_of_locations();
+    std::vector<std::size_t> susceptible_before(number_of_locations);
+    for (auto loc = 0; loc < number_of_locations; loc++) {
+      susceptible_before[loc] = number_of_persons(pi, loc, Person::SUSCEPTIBLE);
+    }
+
+    const auto location = 3;
+    PersonPtrVector susceptible_persons;
+    for (const auto &persons : pi->vPerson()[location][Person::SUSCEPTIBLE]) {
+      susceptible_persons.insert(susceptible_persons.end(), persons.begin(), persons.end());
+    }
+
+    const auto number_of_cases = 30;
+    const ImportationSpec spec(location, number_of_cases, IntVector{1, 2}, DoubleVector{1.0, 1.0});
+    ParasiteImporter::import(spec, number_of_cases);
+
+    for (auto loc = 0; loc < number_of_locations; loc++) {
+      const auto imported = susceptible_before[loc] - number_of_persons(pi, loc, Person::SUSCEPTIBLE);
+      REQUIRE(imported == (loc == location ? number_of_cases : 0));
+    }
+
+    // every imported host is asymptomatic with a single clone of a genotype of the spec
+    auto number_of_imported_hosts = 0;
+    for (auto *p : susceptible_persons) {
+      if (p->host_state() == Person::SUSCEPTIBLE) {
+        continue;
+      }
+      number_of_imported_hosts++;
+      REQUIRE(p->host_state() == Person::ASYMPTOMATIC);
+      REQUIRE(p->all_clonal_parasite_populations()->size() == 1);
+      const auto genotype_id = p->all_clonal_parasite_populations()->parasites()->at(0)->genotype()->genotype_id();
+      REQUIRE((genotype_id == 1 || genotype_id == 2));
+    }
+    REQUIRE(number_of_imported_hosts == number_of_cases);
+  }
+}
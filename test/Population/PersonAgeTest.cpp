@@ -0,0 +1,87 @@
+//
+// PersonAgeTest.cpp
+//
+
+#include "Population/Person.h"
+#include "Population/Population.h"
+#include "Population/Properties/PersonIndexAll.h"
+#include "Model.h"
+#include "Core/Config/Config.h"
+#include "Core/Scheduler.h"
+#include <catch2/catch.hpp>
+
+namespace {
+int time_of(const int &year, const unsigned &month, const unsigned &day) {
+  return Model::SCHEDULER->time_of(date::sys_days{
+      date::year_month_day{date::year{year}, date::month{month}, date::day{day}}});
+}
+
+// moves the scheduler day by day to time, with the age class transitions of each day as in Model::begin_time_step
+void move_to(const int &time) {
+  while (Model::SCHEDULER->current_time() < time) {
+    Model::SCHEDULER->move_to_next_day();
+    Model::POPULATION->perform_age_class_transitions(Model::SCHEDULER->current_time());
+  }
+}
+}
+
+TEST_CASE("PersonAgeTest", "[Population]") {
+  // starting_date: 1990/1/1, age_structure: [1, 2, 3, ...]
+  Model model;
+  model.set_config_filename("input.yml");
+  model.set_config_overrides("{artificial_rescaling_of_population_size: 0.2, ending_date: 1994/1/1}");
+  model.set_initial_seed_number(5);
+  model.set_reporter_type("None");
+  model.initialize();
+  const auto &age_structure = Model::CONFIG->age_structure();
+
+  SECTION("A person born on Feb 29 turns 1 on Mar 1 of the next year") {
+    move_to(time_of(1992, 2, 29));
+    Model::POPULATION->give_1_birth(0);
+    auto *p = Model::POPULATION->all_persons()->vPerson().back();
+    REQUIRE(p->birth_year() == 1992);
+    REQUIRE(p->birth_month_day() == 229);
+    REQUIRE(p->age() == 0);
+    REQUIRE(p->age_class() == 0);
+
+    REQUIRE(p->time_of_age(1) == time_of(1993, 3, 1));
+    REQUIRE(p->age_class_transition_time() == time_of(1993, 3, 1));
+
+    move_to(time_of(1993, 2, 28));
+    REQUIRE(p->age() == 0);
+    REQUIRE(p->age_class() == 0);
+    move_to(time_of(1993, 3, 1));
+    REQUIRE(p->age() == 1);
+    REQUIRE(p->age_class() == 1);
+    REQUIRE(p->age_class_transition_time() == p->time_of_age(age_structure[1]));
+  }
+
+  SECTION("The age class changes on the day the age crosses the age structure boundary") {
+    // after the transitions of the first day (the persons whose next birthday is on day 0), the initial population is
+    // filed under the day of its next age class transition
+    Model::POPULATION->perform_age_class_transitions(0);
+    Person *first = nullptr;
+    for (auto *p : Model::POPULATION->all_persons()->vPerson()) {
+      REQUIRE(p->has_birth_date());
+      if (p->age_class() == Model::CONFIG->number_of_age_classes() - 1) {
+        REQUIRE(p->age_class_transition_time() == -1);
+        continue;
+      }
+      REQUIRE(p->age() < age_structure[p->age_class()]);
+      REQUIRE(p->age_class_transition_time() == p->time_of_age(age_structure[p->age_class()]));
+      if (first == nullptr || p->age_class_transition_time() < first->age_class_transition_time()) {
+        first = p;
+      }
+    }
+    REQUIRE(first != nullptr);
+
+    const auto transition_time = first->age_class_transition_time();
+    const auto age_class = first->age_class();
+    move_to(transition_time - 1);
+    REQUIRE(first->age() == age_structure[age_class] - 1);
+    REQUIRE(first->age_class() == age_class);
+    move_to(transition_time);
+    REQUIRE(first->age() == age_structure[age_class]);
+    REQUIRE(first->age_class() == age_class + 1);
+  }
+}
@@ -0,0 +1,117 @@
+//
+// PersonIndexByCompartmentTest.cpp
+//
+
+#include "Population/Properties/PersonIndexByCompartment.h"
+#include "Population/Properties/PersonIndexByLocationBittingLevel.h"
+#include "Population/Properties/PersonIndexAll.h"
+#include "Population/ParasiteImporter.h"
+#include "Population/Population.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Model.h"
+#include "Core/Config/Config.h"
+#include <set>
+#include <catch2/catch.hpp>
+
+namespace {
+// the persons simulated individually and the compartment of each location and biting level are together the persons
+// of the biting level index
+void require_same_persons_as_biting_level_index() {
+  auto *compartments = Model::POPULATION->get_person_index<PersonIndexByCompartment>();
+  auto *biting_levels = Model::POPULATION->get_person_index<PersonIndexByLocationBittingLevel>();
+  std::size_t number_of_persons_in_compartments = 0;
+  for (auto loc = 0ul; loc < biting_levels->vPerson().size(); loc++) {
+    for (auto level = 0ul; level < biting_levels->vPerson()[loc].size(); level++) {
+      const auto &individuals = compartments->vPerson()[loc][level];
+      const auto &compartment = compartments->compartments()[loc][level];
+      for (auto *p : individuals) {
+        REQUIRE_FALSE(p->in_compartment());
+      }
+      for (auto *p : compartment) {
+        REQUIRE(p->in_compartment());
+      }
+      std::set<Person *> persons(individuals.begin(), individuals.end());
+      persons.insert(compartment.begin(), compartment.end());
+      REQUIRE(persons.size() == individuals.size() + compartment.size());
+      const auto &expected = biting_levels->vPerson()[loc][level];
+      REQUIRE(persons == std::set<Person *>(expected.begin(), expected.end()));
+      number_of_persons_in_compartments += compartment.size();
+    }
+  }
+  REQUIRE(compartments->size() == number_of_persons_in_compartments);
+}
+
+Person *first_person_in_compartment() {
+  for (auto *p : Model::POPULATION->all_persons()->vPerson()) {
+    if (p->in_compartment()) return p;
+  }
+  return nullptr;
+}
+}
+
+TEST_CASE("PersonIndexByCompartmentTest", "[Population]") {
+  Model model;
+  model.set_config_filename("input.yml");
+  model.set_config_overrides(
+      "{artificial_rescaling_of_population_size: 0.05, using_hybrid_compartmental_mode: true,"
+      " initial_parasite_info: [], events: []}");
+  model.set_initial_seed_number(5);
+  model.set_reporter_type("None");
+  model.initialize();
+
+  // as at their first UpdateEveryKDaysEvent
+  for (auto *p : Model::POPULATION->all_persons()->vPerson()) {
+    if (p->can_join_compartment()) {
+      Model::POPULATION->move_to_compartment(p);
+    }
+  }
+  auto *compartments = Model::POPULATION->get_person_index<PersonIndexByCompartment>();
+  const auto number_of_persons_in_compartments = compartments->size();
+  REQUIRE(number_of_persons_in_compartments > 0);
+  require_same_persons_as_biting_level_index();
+
+  SECTION("A person keeps its compartment membership when it moves or changes biting level") {
+    auto *p = first_person_in_compartment();
+    p->set_location((p->location() + 1) % Model::CONFIG->number_of_locations());
+    p->set_bitting_level((p->bitting_level() + 1) % Model::CONFIG->relative_bitting_info().number_of_biting_levels);
+    REQUIRE(p->in_compartment());
+    REQUIRE(compartments->size() == number_of_persons_in_compartments);
+    require_same_persons_as_biting_level_index();
+  }
+
+  SECTION("An infected person leaves its compartment") {
+    auto *p = first_person_in_compartment();
+    p->infected_by(0);
+    REQUIRE_FALSE(p->in_compartment());
+    REQUIRE(compartments->size() == number_of_persons_in_compartments - 1);
+    require_same_persons_as_biting_level_index();
+  }
+
+  SECTION("A treated person leaves its compartment") {
+    auto *p = first_person_in_compartment();
+    p->receive_therapy(Model::CONFIG->therapy_db()[0], nullptr);
+    REQUIRE_FALSE(p->in_compartment());
+    REQUIRE_FALSE(p->can_join_compartment());
+    REQUIRE(compartments->size() == number_of_persons_in_compartments - 1);
+    require_same_persons_as_biting_level_index();
+  }
+
+  SECTION("An imported case leaves its compartment") {
+    auto *p = first_person_in_compartment();
+    ParasiteImporter::infect(p, Model::CONFIG->genotype_db()->at(0));
+    REQUIRE_FALSE(p->in_compartment());
+    REQUIRE(p->all_clonal_parasite_populations()->size() == 1);
+    REQUIRE(compartments->size() == number_of_persons_in_compartments - 1);
+    require_same_persons_as_biting_level_index();
+
+    ParasiteImporter::import(ImportationSpec(0, 1, IntVector{1}, DoubleVector{1.0}), 10);
+    for (auto *person : Model::POPULATION->all_persons()->vPerson()) {
+      if (person->all_clonal_parasite_populations()->size() > 0) {
+        REQUIRE_FALSE(person->in_compartment());
+      }
+    }
+    require_same_persons_as_biting_level_index();
+  }
+}
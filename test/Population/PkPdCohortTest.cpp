@@ -0,0 +1,158 @@
+//
+// PkPdCohortTest.cpp
+//
+
+#include "Population/PkPdCohort.h"
+#include "Population/DrugsInBlood.h"
+#include "Population/Population.h"
+#include "Population/Properties/PersonIndexAll.h"
+#include "Population/ImmuneSystem.h"
+#include "Core/Config/Config.h"
+#include "Core/Random.h"
+#include "Core/Scheduler.h"
+#include "Events/ProgressToClinicalEvent.h"
+#include "MDC/ModelDataCollector.h"
+#include "Model.h"
+#include "Parasites/Genotype.h"
+#include "Reporters/ModeComparison.h"
+#include "Strategies/SFTStrategy.h"
+#include "Therapies/SCTherapy.h"
+#include <catch2/catch.hpp>
+
+namespace {
+// a small DxGGenerator input
+const auto DXG_OVERRIDES = "{artificial_rescaling_of_population_size: 0.1}";
+
+// the --full-model path of DxGGenerator (getEfficacyForTherapy) on a new model
+double get_full_model_efficacy(const int &genotype_id, const int &therapy_id, const unsigned long &seed) {
+  Model model;
+  model.set_config_filename("input_DxG.yml");
+  model.set_config_overrides(DXG_OVERRIDES);
+  model.set_initial_seed_number(seed);
+  model.set_reporter_type("None");
+  model.initialize();
+
+  auto *strategy = dynamic_cast<SFTStrategy *>(Model::TREATMENT_STRATEGY);
+  REQUIRE(strategy != nullptr);
+  strategy->get_therapy_list().clear();
+  strategy->add_therapy(Model::CONFIG->therapy_db()[therapy_id]);
+
+  auto *genotype = Model::CONFIG->genotype_db()->at(genotype_id);
+  for (auto *person : Model::POPULATION->all_persons()->vPerson()) {
+    auto *blood_parasite = person->add_new_parasite_to_blood(genotype);
+    person->immune_system()->set_increase(true);
+    person->set_host_state(Person::EXPOSED);
+    blood_parasite->set_gametocyte_level(Model::CONFIG->gametocyte_level_full());
+    blood_parasite->set_last_update_log10_parasite_density(
+        Model::CONFIG->parasite_density_level().log_parasite_density_from_liver);
+    ProgressToClinicalEvent::schedule_event(Model::SCHEDULER, person, blood_parasite, 1);
+  }
+
+  model.run();
+  return 1 - Model::DATA_COLLECTOR->blood_slide_prevalence_by_location()[0];
+}
+}
+
+TEST_CASE("PkPdCohortTest", "[Population]") {
+  Config c;
+  c.read_from_file("input.yml");
+  // a 28 days follow-up of a small cohort
+  c.total_time() = 28;
+  c.artificial_rescaling_of_population_size() = 0.05;
+
+  auto *genotype = c.genotype_db()->at(0);
+  auto *therapy = dynamic_cast<SCTherapy *>(c.therapy_db()[0]);
+  REQUIRE(therapy != nullptr);
+
+  const auto get_efficacy = [&](const unsigned long &seed) {
+    Random random;
+    random.initialize(seed);
+    PkPdCohort cohort(&c, &random);
+    return cohort.get_efficacy(genotype, therapy);
+  };
+
+  SECTION("The cohort has the population of the config") {
+    Random random;
+    random.initialize(1);
+    PkPdCohort cohort(&c, &random);
+    cohort.get_efficacy(genotype, therapy);
+
+    std::size_t population_size = 0;
+    for (const auto &location : c.location_db()) {
+      population_size += static_cast<int>(location.population_size * c.artificial_rescaling_of_population_size());
+    }
+    REQUIRE(cohort.size() == population_size);
+  }
+
+  SECTION("The efficacy only depends on the seed") {
+    const auto efficacy = get_efficacy(1);
+    REQUIRE(efficacy > 0);
+    REQUIRE(efficacy < 1);
+    REQUIRE(get_efficacy(1) == efficacy);
+  }
+
+  SECTION("A higher EC50 lowers the efficacy") {
+    const auto efficacy = get_efficacy(1);
+    const auto drug_id = therapy->drug_ids[0];
+    const auto ec50_power_n = c.EC50_power_n_table()[genotype->genotype_id()][drug_id];
+    c.EC50_power_n_table()[genotype->genotype_id()][drug_id] = 1e6 * ec50_power_n;
+    REQUIRE(get_efficacy(1) < efficacy - 0.1);
+    c.EC50_power_n_table()[genotype->genotype_id()][drug_id] = ec50_power_n;
+  }
+}
+
+TEST_CASE("PkPdCohortDxGInputTest", "[Population]") {
+  // the DxGGenerator input, whose drug database is larger than the other inputs
+  Config c;
+  c.read_from_file("input_DxG.yml");
+  c.artificial_rescaling_of_population_size() = 0.05;
+  REQUIRE(c.drug_db()->size() > DrugsInBlood::CAPACITY);
+
+  Random random;
+  random.initialize(1);
+  PkPdCohort cohort(&c, &random);
+  auto *genotype = c.genotype_db()->at(0);
+  auto number_of_therapies = 0;
+  for (auto *therapy : c.therapy_db()) {
+    auto *sc_therapy = dynamic_cast<SCTherapy *>(therapy);
+    if (sc_therapy == nullptr) {
+      continue;
+    }
+    number_of_therapies++;
+    const auto efficacy = cohort.get_efficacy(genotype, sc_therapy);
+    REQUIRE(efficacy >= 0);
+    REQUIRE(efficacy <= 1);
+  }
+  REQUIRE(number_of_therapies > 0);
+}
+
+TEST_CASE("PkPdCohortFullModelTest", "[Population]") {
+  // MQ against a sensitive genotype and a MQ resistant genotype (double copy of pfmdr1)
+  const auto therapy_id = 4;
+  const auto number_of_replicates = 5;
+
+  Config c;
+  c.read_from_file("input_DxG.yml", "", DXG_OVERRIDES);
+  auto *therapy = dynamic_cast<SCTherapy *>(c.therapy_db()[therapy_id]);
+  REQUIRE(therapy != nullptr);
+
+  std::vector<double> means;
+  for (const auto genotype_id : {0, 32}) {
+    std::vector<double> full_model_efficacies, cohort_efficacies;
+    for (auto seed = 1ul; seed <= number_of_replicates; seed++) {
+      full_model_efficacies.push_back(get_full_model_efficacy(genotype_id, therapy_id, seed));
+
+      Random random;
+      random.initialize(seed);
+      PkPdCohort cohort(&c, &random);
+      cohort_efficacies.push_back(cohort.get_efficacy(c.genotype_db()->at(genotype_id), therapy));
+    }
+    const auto result = ModeComparison::compare("efficacy of genotype " + std::to_string(genotype_id),
+                                                full_model_efficacies, cohort_efficacies);
+    INFO(result.name << ": " << result.mean << " full model, " << result.mean_with_overrides << " cohort, z = "
+                     << result.z_score);
+    REQUIRE(result.passed);
+    means.push_back(result.mean_with_overrides);
+  }
+  REQUIRE(means[1] < means[0] - 0.2);
+}
@@ -0,0 +1,41 @@
+//
+// ModeComparisonTest.cpp
+//
+
+#include "Reporters/ModeComparison.h"
+#include <cmath>
+#include <vector>
+#include <catch2/catch.hpp>
+
+TEST_CASE("ModeComparisonTest", "[Reporters]") {
+
+  SECTION("Samples from the same distribution pass") {
+    const std::vector<double> samples{0.31, 0.29, 0.30, 0.32, 0.28};
+    const std::vector<double> samples_with_overrides{0.30, 0.33, 0.29, 0.31, 0.30};
+
+    const auto result = ModeComparison::compare("prevalence", samples, samples_with_overrides);
+    REQUIRE(result.mean == Approx(0.30));
+    REQUIRE(result.mean_with_overrides == Approx(0.306));
+    REQUIRE(result.z_score == Approx(0.006/std::sqrt(0.000096)));
+    REQUIRE(result.passed);
+  }
+
+  SECTION("A shift that is large and significant fails") {
+    const std::vector<double> samples{0.31, 0.29, 0.30, 0.32, 0.28};
+    const std::vector<double> samples_with_overrides{0.36, 0.34, 0.35, 0.37, 0.33};
+
+    const auto result = ModeComparison::compare("prevalence", samples, samples_with_overrides);
+    REQUIRE(result.z_score > 3);
+    REQUIRE(result.relative_difference == Approx(0.05/0.30));
+    REQUIRE_FALSE(result.passed);
+  }
+
+  SECTION("A significant shift within the relative tolerance passes") {
+    const std::vector<double> samples{1000, 1000, 1000};
+    const std::vector<double> samples_with_overrides{1010, 1010, 1010};
+
+    const auto result = ModeComparison::compare("population size", samples, samples_with_overrides);
+    REQUIRE(std::isinf(result.z_score));
+    REQUIRE(result.passed);
+  }
+}
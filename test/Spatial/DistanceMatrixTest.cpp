@@ -0,0 +1,79 @@
+//
+// DistanceMatrixTest.cpp
+//
+
+#include "Spatial/DistanceMatrix.h"
+#include <cmath>
+#include <limits>
+#include <catch2/catch.hpp>
+
+using namespace Spatial;
+
+TEST_CASE("DistanceMatrixTest", "[Spatial]") {
+  // 50 x 50 grid of 0.2 degree pixels
+  std::vector<Location> locations;
+  for (auto i = 0; i < 2500; i++) {
+    locations.emplace_back(i, 10 + 0.2f * (i / 50), 100 + 0.2f * (i % 50), 1000);
+  }
+
+  SECTION("Rows are computed on first use, a block at a time") {
+    DistanceMatrix matrix;
+    matrix.initialize(locations);
+    REQUIRE(matrix.number_of_computed_rows() == 0);
+
+    const auto &row = matrix.row(130);
+    REQUIRE(matrix.number_of_computed_rows() == DistanceMatrix::ROWS_PER_BLOCK);
+    REQUIRE(row.size() == locations.size());
+
+    for (auto to : {0, 130, 1111, 2499}) {
+      const auto expected = Coordinate::calculate_distance_in_km(*locations[130].coordinate,
+                                                                 *locations[to].coordinate);
+      REQUIRE(matrix.distance(130, to) == Approx(expected).epsilon(1e-6));
+      REQUIRE(row.location(to) == to);
+    }
+  }
+
+  SECTION("Cutoff keeps only destinations within the radius") {
+    DistanceMatrix matrix;
+    matrix.initialize(locations, 100);
+
+    const auto &row = matrix.row(1275);
+    REQUIRE(row.size() < locations.size());
+    for (auto i = 0ul; i < row.size(); i++) {
+      REQUIRE(row.distances[i] <= 100);
+      if (i > 0) {
+        REQUIRE(row.locations[i - 1] < row.locations[i]);
+      }
+    }
+    REQUIRE(matrix.distance(1275, 1276) == Approx(
+        Coordinate::calculate_distance_in_km(*locations[1275].coordinate, *locations[1276].coordinate)));
+    REQUIRE(std::isinf(matrix.distance(1275, 0)));
+
+    // every location within the cutoff is kept
+    auto within_cutoff = 0ul;
+    for (const auto &location : locations) {
+      if (Coordinate::calculate_distance_in_km(*locations[1275].coordinate, *location.coordinate) <= 100) {
+        within_cutoff++;
+      }
+    }
+    REQUIRE(row.size() == within_cutoff);
+  }
+
+  SECTION("Rows set from given distances match computed rows") {
+    DistanceMatrix computed;
+    computed.initialize(locations, 100);
+    computed.compute_all();
+    REQUIRE(computed.number_of_computed_rows() == static_cast<int>(locations.size()));
+
+    DistanceMatrix loaded;
+    loaded.initialize(locations, 100);
+    DoubleVector dense(locations.size());
+    for (auto to = 0; to < static_cast<int>(locations.size()); to++) {
+      dense[to] = computed.distance(42, to);
+    }
+    loaded.set_row(42, dense);
+    REQUIRE(loaded.number_of_computed_rows() == 1);
+    REQUIRE(loaded.row(42).locations == computed.row(42).locations);
+    REQUIRE(loaded.row(42).distances == computed.row(42).distances);
+  }
+}
@@ -0,0 +1,119 @@
+//
+// SpatialModelTest.cpp
+//
+
+#include "Spatial/WesolowskiSM.h"
+#include "Spatial/BarabasiSM.h"
+#include <cmath>
+#include <catch2/catch.hpp>
+
+using namespace Spatial;
+
+TEST_CASE("SpatialModelTest", "[Spatial]") {
+  std::vector<Location> locations;
+  for (auto i = 0; i < 20; i++) {
+    locations.emplace_back(i, 10 + 0.3f * (i / 5), 100 + 0.3f * (i % 5), 1000);
+  }
+  DistanceMatrix distances;
+  distances.initialize(locations);
+
+  IntVector residents;
+  for (auto i = 0; i < 20; i++) {
+    residents.push_back(1000 + 100 * i);
+  }
+
+  auto node = YAML::Load("{kappa: 0.01093251, alpha: 0.22268982, beta: 0.14319618, gamma: 0.83741484}");
+  WesolowskiSM model(node);
+  model.update_residents(residents, 0);
+
+  SECTION("Cached kernel matches the Wesolowski formula") {
+    const auto *movement = model.get_v_relative_out_movement_to_destination(7, distances);
+    for (auto to = 0; to < 20; to++) {
+      const auto d = distances.distance(7, to);
+      const auto expected = (to == 7) ? 0.0 : model.kappa() * pow(residents[7], model.alpha())
+          * pow(residents[to], model.beta()) / pow(d, model.gamma());
+      REQUIRE(movement[to] == Approx(expected).epsilon(1e-12));
+    }
+  }
+
+  SECTION("Kernel is recombined when the residents version changes") {
+    const auto before = model.get_v_relative_out_movement_to_destination(3, distances)[12];
+    residents[12] *= 2;
+
+    // same version, the residents are not read again
+    model.update_residents(residents, 0);
+    REQUIRE(model.get_v_relative_out_movement_to_destination(3, distances)[12] == before);
+
+    model.update_residents(residents, 1);
+    const auto after = model.get_v_relative_out_movement_to_destination(3, distances)[12];
+    REQUIRE(after == Approx(before * pow(2.0, model.beta())).epsilon(1e-12));
+  }
+
+  SECTION("Kernel follows the sparse distance row") {
+    DistanceMatrix sparse;
+    sparse.initialize(locations, 40);
+    BarabasiSM barabasi(YAML::Load("{r_g_0: 5.8, beta_r: 1.65, kappa: 350}"));
+    barabasi.update_residents(residents, 0);
+
+    const auto &row = sparse.row(0);
+    const auto *movement = barabasi.get_v_relative_out_movement_to_destination(0, sparse);
+    for (auto i = 0ul; i < row.size(); i++) {
+      const double d = row.distances[i];
+      const auto expected = row.location(i) == 0 ? 0.0 : pow(d + 5.8, -1.65) * exp(-5.8 / 350);
+      REQUIRE(movement[i] == Approx(expected).epsilon(1e-12));
+    }
+  }
+
+  SECTION("Destination sampler keeps only the non-negligible destinations") {
+    const auto *movement = model.get_v_relative_out_movement_to_destination(0, distances);
+    auto total = 0.0;
+    for (auto to = 0; to < 20; to++) {
+      total += movement[to];
+    }
+
+    const auto &all = model.get_destination_sampler(0, distances, 0.0);
+    REQUIRE(all.locations.size() == 19);
+    REQUIRE(all.table.total_weight() == Approx(total));
+
+    WesolowskiSM other(node);
+    other.update_residents(residents, 0);
+    const auto &sampler = other.get_destination_sampler(0, distances, 0.06);
+    REQUIRE(sampler.locations.size() < 19);
+    for (auto location : sampler.locations) {
+      REQUIRE(movement[location] > 0.06 * total);
+    }
+  }
+
+  SECTION("Destination sampler follows the sparse distance row") {
+    DistanceMatrix sparse;
+    sparse.initialize(locations, 40);
+    const auto &row = sparse.row(0);
+    auto total = 0.0;
+    for (auto i = 0ul; i < row.size(); i++) {
+      if (row.location(i) == 0) continue;
+      total += model.get_distance_factor(row.distances[i]) * pow(residents[0], model.alpha())
+          * pow(residents[row.location(i)], model.beta());
+    }
+
+    const auto &sampler = model.get_destination_sampler(0, sparse, 0.0);
+    REQUIRE(sampler.locations.size() == row.size() - 1);
+    REQUIRE(sampler.locations.size() < 19);
+    REQUIRE(sampler.table.total_weight() == Approx(total).epsilon(1e-12));
+  }
+
+  SECTION("Destination sampler is only rebuilt when the residents version changes") {
+    const auto &sampler = model.get_destination_sampler(4, distances, 0.0);
+    const auto version = sampler.version;
+    const auto total = sampler.table.total_weight();
+
+    residents[9] *= 4;
+    model.update_residents(residents, 0);
+    REQUIRE(model.get_destination_sampler(4, distances, 0.0).version == version);
+    REQUIRE(model.get_destination_sampler(4, distances, 0.0).table.total_weight() == total);
+
+    model.update_residents(residents, 1);
+    const auto &rebuilt = model.get_destination_sampler(4, distances, 0.0);
+    REQUIRE(rebuilt.version != version);
+    REQUIRE(rebuilt.table.total_weight() > total);
+  }
+}
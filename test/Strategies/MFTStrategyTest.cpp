@@ -0,0 +1,78 @@
+//
+// MFTStrategyTest.cpp
+//
+
+#include "Strategies/MFTStrategy.h"
+#include "Strategies/NestedMFTStrategy.h"
+#include "Therapies/SCTherapy.h"
+#include "Core/Random.h"
+#include "Model.h"
+#include <catch2/catch.hpp>
+
+TEST_CASE("MFTStrategyTest", "[Strategies]") {
+  std::vector<SCTherapy *> therapies;
+  for (auto i = 0; i < 4; i++) {
+    therapies.push_back(new SCTherapy());
+    therapies.back()->set_id(i);
+  }
+
+  MFTStrategy mft;
+  for (auto *therapy : therapies) {
+    mft.add_therapy(therapy);
+  }
+  mft.distribution = {0.1, 0.2, 0.3, 0.4};
+
+  // the scan the strategies used before compiling their distribution
+  const auto scan = [](const DoubleVector &distribution, const double &p) {
+    double sum = 0;
+    for (auto i = 0ul; i < distribution.size(); i++) {
+      sum += distribution[i];
+      if (p <= sum) {
+        return i;
+      }
+    }
+    return distribution.size() - 1;
+  };
+
+  Random random, expected_random;
+  random.initialize(42);
+  expected_random.initialize(42);
+  Model::RANDOM = &random;
+
+  SECTION("MFT draws match the scan under the same random stream") {
+    for (auto i = 0; i < 10000; i++) {
+      const auto expected = scan(mft.distribution, expected_random.random_flat(0.0, 1.0));
+      REQUIRE(mft.get_therapy(nullptr) == therapies[expected]);
+    }
+
+    mft.distribution = {0.5, 0.0, 0.25, 0.25};
+    mft.update_distribution_table();
+    for (auto i = 0; i < 10000; i++) {
+      const auto expected = scan(mft.distribution, expected_random.random_flat(0.0, 1.0));
+      REQUIRE(mft.get_therapy(nullptr) == therapies[expected]);
+    }
+  }
+
+  SECTION("Nested MFT draws match the nested scans under the same random stream") {
+    NestedMFTStrategy nested;
+    nested.add_strategy(&mft);
+    MFTStrategy other;
+    other.add_therapy(therapies[3]);
+    other.distribution = {1.0};
+    nested.add_strategy(&other);
+    nested.distribution = {0.7, 0.3};
+
+    for (auto i = 0; i < 10000; i++) {
+      // both nested strategies draw once more
+      const auto p_nested = expected_random.random_flat(0.0, 1.0);
+      const auto p = expected_random.random_flat(0.0, 1.0);
+      auto *expected = scan(nested.distribution, p_nested) == 0 ? therapies[scan(mft.distribution, p)] : therapies[3];
+      REQUIRE(nested.get_therapy(nullptr) == expected);
+    }
+  }
+
+  Model::RANDOM = nullptr;
+  for (auto *therapy : therapies) {
+    delete therapy;
+  }
+}
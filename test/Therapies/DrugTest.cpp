@@ -0,0 +1,75 @@
+//
+// DrugTest.cpp
+//
+
+#include "Therapies/Drug.h"
+#include "Therapies/DrugDatabase.h"
+#include "Model.h"
+#include "Core/Config/Config.h"
+#include "Core/Random.h"
+#include "Core/Scheduler.h"
+#include <catch2/catch.hpp>
+
+TEST_CASE("DrugTest", "[Therapies]") {
+  Model model;
+  model.set_config_filename("input.yml");
+  model.set_config_overrides("{artificial_rescaling_of_population_size: 0.05}");
+  model.set_initial_seed_number(5);
+  model.set_reporter_type("None");
+  model.initialize();
+
+  SECTION("The lazy and eager concentrations are the same on each day") {
+    // the dosing phase draws random numbers, each mode gets its own generator with the same seed
+    Random eager_random, lazy_random;
+    eager_random.initialize(7);
+    lazy_random.initialize(7);
+    auto *model_random = Model::RANDOM;
+    auto &using_lazy_drug_concentration = Model::CONFIG->using_lazy_drug_concentration();
+    const auto using_lazy = using_lazy_drug_concentration;
+
+    std::vector<Drug> eager_drugs, lazy_drugs;
+    for (const auto &drug_type : *Model::CONFIG->drug_db()) {
+      Drug drug(drug_type.second);
+      drug.set_starting_value(1.0);
+      drug.set_number_of_dosing_days(3);
+      eager_drugs.push_back(drug);
+      lazy_drugs.push_back(drug);
+    }
+
+    auto number_of_active_drugs = eager_drugs.size();
+    while (number_of_active_drugs > 0) {
+      Model::SCHEDULER->move_to_next_day();
+      REQUIRE(Model::SCHEDULER->current_time() < 365);
+      number_of_active_drugs = 0;
+      for (auto i = 0ul; i < eager_drugs.size(); i++) {
+        auto &eager = eager_drugs[i];
+        auto &lazy = lazy_drugs[i];
+        if (eager.is_cut_off()) {
+          REQUIRE(lazy.is_cut_off());
+          continue;
+        }
+        number_of_active_drugs++;
+
+        Model::RANDOM = &eager_random;
+        using_lazy_drug_concentration = false;
+        eager.update();
+        Model::RANDOM = &lazy_random;
+        using_lazy_drug_concentration = true;
+        lazy.update();
+
+        // the cut-off is decided before the pending concentration is evaluated
+        REQUIRE(lazy.is_cut_off() == eager.is_cut_off());
+        REQUIRE(lazy.last_update_value() == eager.last_update_value());
+        REQUIRE(lazy.is_cut_off() == eager.is_cut_off());
+      }
+    }
+    Model::RANDOM = model_random;
+    using_lazy_drug_concentration = using_lazy;
+
+    for (auto i = 0ul; i < eager_drugs.size(); i++) {
+      const auto cut_off_days = lazy_drugs[i].get_cut_off_days(lazy_drugs[i].drug_type());
+      REQUIRE(eager_drugs[i].last_update_time() - eager_drugs[i].start_time() == cut_off_days);
+      REQUIRE(lazy_drugs[i].end_time() == lazy_drugs[i].start_time() + cut_off_days);
+    }
+  }
+}
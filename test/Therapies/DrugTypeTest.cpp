@@ -0,0 +1,48 @@
+//
+// DrugTypeTest.cpp
+//
+
+#include "Core/Config/Config.h"
+#include "Therapies/DrugType.h"
+#include <catch2/catch.hpp>
+
+TEST_CASE("DrugTypeTest", "[Therapies]") {
+  Config c;
+  c.read_from_file("input.yml");
+  const auto &table = c.EC50_power_n_table();
+
+  SECTION("EC50^n table is one contiguous row of drugs per genotype") {
+    REQUIRE(table.values().size() == table.rows() * table.cols());
+    REQUIRE(&table[1][0] == &table[0][0] + table.cols());
+    REQUIRE(DoubleMatrix(table.to_nested()) == table);
+  }
+
+  SECTION("Killing rate kernel gives the same rates as the per drug evaluation") {
+    const IntVector drug_ids{0, 3, 6};
+    const DoubleVector concentrations{1.0, 0.35, 0.02};
+    DoubleVector concentration_power_n, maximum_killing_rates;
+    for (auto d = 0ul; d < drug_ids.size(); d++) {
+      auto *drug_type = c.drug_db()->at(drug_ids[d]);
+      concentration_power_n.push_back(drug_type->get_concentration_power_n(concentrations[d]));
+      maximum_killing_rates.push_back(drug_type->maximum_parasite_killing_rate());
+    }
+
+    IntVector genotype_ids;
+    for (auto g = 0; g < static_cast<int>(table.rows()); g++) {
+      for (auto d = 0ul; d < drug_ids.size(); d++) {
+        genotype_ids.push_back((g + static_cast<int>(d)) % static_cast<int>(table.rows()));
+      }
+    }
+
+    DoubleVector killing_rates(genotype_ids.size());
+    DrugType::get_parasite_killing_rates(table, genotype_ids.data(), table.rows(), drug_ids.data(),
+                                         concentration_power_n.data(), maximum_killing_rates.data(), drug_ids.size(),
+                                         killing_rates.data());
+
+    for (auto i = 0ul; i < genotype_ids.size(); i++) {
+      const auto d = i % drug_ids.size();
+      REQUIRE(killing_rates[i] == c.drug_db()->at(drug_ids[d])->get_parasite_killing_rate_by_concentration(
+          concentrations[d], table[genotype_ids[i]][drug_ids[d]]));
+    }
+  }
+}